@@ -18,6 +18,7 @@ be_extern_native_module(os);
 be_extern_native_module(global);
 be_extern_native_module(sys);
 be_extern_native_module(debug);
+be_extern_native_module(profiler);
 be_extern_native_module(gc);
 be_extern_native_module(solidify);
 be_extern_native_module(introspect);
@@ -30,6 +31,8 @@ be_extern_native_module(cb);
 /* Tasmota specific */
 be_extern_native_module(python_compat);
 be_extern_native_module(re);
+be_extern_native_module(tasmota_ntv);
+be_extern_native_module(dsl_scanner_ntv);
 be_extern_native_module(mqtt);
 be_extern_native_module(persist);
 be_extern_native_module(autoconf);
@@ -136,6 +139,9 @@ BERRY_LOCAL const bntvmodule_t* const be_module_table[] = {
 #if BE_USE_DEBUG_MODULE
     &be_native_module(debug),
 #endif
+#if BE_USE_PROFILER
+    &be_native_module(profiler),
+#endif
 #if BE_USE_GC_MODULE
     &be_native_module(gc),
 #endif
@@ -151,6 +157,8 @@ BERRY_LOCAL const bntvmodule_t* const be_module_table[] = {
     &be_native_module(undefined),
 
     &be_native_module(re),
+    &be_native_module(tasmota_ntv),
+    &be_native_module(dsl_scanner_ntv),
 #ifdef TASMOTA
     /* Berry extensions */
     &be_native_module(cb),
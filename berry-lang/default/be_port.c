@@ -708,4 +708,57 @@ int be_dirclose(bdirinfo *info)
 #endif /* POSIX */
 #endif /* BE_USE_OS_MODULE || BE_USE_FILE_SYSTEM */
 
+/* map a whole file in memory for the bytecode loader, the mapping is
+ * private: it can be written but changes are not written back to the file */
+#if BE_USE_BYTECODE_MMAP
+#if !defined(USE_FATFS) && !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+void* be_fmap(const char *filename, size_t *size)
+{
+    void *data = NULL;
+    struct stat st;
+    int fd = open(filename, O_RDONLY);
+    if (fd >= 0) {
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            data = mmap(NULL, (size_t)st.st_size,
+                PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                data = NULL;
+            } else {
+                *size = (size_t)st.st_size;
+            }
+        }
+        close(fd);
+    }
+    return data;
+}
+
+void be_funmap(void *data, size_t size)
+{
+    munmap(data, size);
+}
+
+#else /* no memory mapped files, the loader reads files instead */
+
+void* be_fmap(const char *filename, size_t *size)
+{
+    (void)filename;
+    (void)size;
+    return NULL;
+}
+
+void be_funmap(void *data, size_t size)
+{
+    (void)data;
+    (void)size;
+}
+
+#endif
+#endif /* BE_USE_BYTECODE_MMAP */
+
 #endif // COMPILE_BERRY_LIB
@@ -9,6 +9,8 @@
 #include "be_mem.h"
 #include "be_object.h"
 #include "be_exec.h"
+#include "be_map.h"
+#include "be_vm.h"
 #include "../re1.5/re1.5.h"
 
 /********************************************************************
@@ -35,28 +37,191 @@ re.split = def (regex_str, str) end # native
 
 extern const bclass be_class_re_pattern;
 
+#ifndef BE_RE_CACHE_SIZE
+#define BE_RE_CACHE_SIZE      8       // patterns passed as strings or bytes to `re` functions, compiled once
+#endif
+#ifndef BE_RE_DFA_CACHE_SIZE
+#define BE_RE_DFA_CACHE_SIZE  2048    // bytes of DFA states per pattern
+#endif
+
+// Compiled pattern, the DFA is built on first match
+typedef struct re_prog {
+  ByteProg *code;     // follows the struct in the same allocation
+  DFA *dfa;           // NULL if the pattern has captures or doesn't fit
+  bbool dfa_built;
+} re_prog;
+
+static re_prog *re_prog_alloc(bvm *vm, int sz) {
+  re_prog *prog = be_os_malloc(sizeof(re_prog) + sizeof(ByteProg) + sz);
+  if (prog == NULL) {
+    be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
+  }
+  prog->code = (ByteProg*) (prog + 1);
+  prog->dfa = NULL;
+  prog->dfa_built = bfalse;
+  return prog;
+}
+
+static void re_prog_free(re_prog *prog) {
+  if (prog != NULL) {
+    re1_5_dfa_free(prog->dfa);
+    be_os_free(prog);
+  }
+}
+
+// Compile a pattern string, raises an error if invalid
+static re_prog *re_prog_compile(bvm *vm, const char *regex_str) {
+  int sz = re1_5_sizecode(regex_str);
+  if (sz < 0) {
+    be_raise(vm, "internal_error", "error in regex");
+  }
+  re_prog *prog = re_prog_alloc(vm, sz);
+  int ret = re1_5_compilecode(prog->code, regex_str);
+  if (ret != 0) {
+    re_prog_free(prog);
+    be_raise(vm, "internal_error", "error in regex");
+  }
+  return prog;
+}
+
+// Copy a program compiled by `re.compilebytes()`
+static re_prog *re_prog_copy(bvm *vm, const void *code, size_t len) {
+  if (len < sizeof(ByteProg)) {
+    be_raise(vm, "value_error", "invalid regex bytecode");
+  }
+  re_prog *prog = re_prog_alloc(vm, len - sizeof(ByteProg));
+  memcpy(prog->code, code, len);
+  return prog;
+}
+
+// comobj destructor
+static int re_prog_destroy(bvm *vm) {
+  if (be_top(vm) > 0) {
+    re_prog_free((re_prog*) be_tocomptr(vm, 1));
+  }
+  be_return_nil(vm);
+}
+
+// Same as `re1_5_recursiveloopprog()`, with the DFA when the pattern has no captures
+static int re_prog_run(re_prog *prog, Subject *subj, const char **sub, int sub_els, bbool is_anchored) {
+  if (!prog->dfa_built) {
+    prog->dfa = re1_5_dfa_new(prog->code, BE_RE_DFA_CACHE_SIZE);
+    prog->dfa_built = btrue;
+  }
+  if (prog->dfa) {
+    return re1_5_dfa(prog->dfa, subj, sub, sub_els, is_anchored);
+  }
+  return re1_5_recursiveloopprog(prog->code, subj, sub, sub_els, is_anchored);
+}
+
+// LRU cache of compiled patterns, keyed by pattern string or by `compilebytes()` program
+typedef struct re_cache_entry {
+  re_prog *prog;
+  char *key;
+  size_t len;
+  bbool is_bytes;
+  uint32_t last_used;
+} re_cache_entry;
+
+typedef struct re_cache {
+  re_cache_entry entries[BE_RE_CACHE_SIZE];
+  uint32_t clock;
+} re_cache;
+
+// key of the cache in the native class table of the VM
+static const char re_cache_key = 0;
+
+// comobj destructor, called by the GC when the VM is deleted
+static int re_cache_destroy(bvm *vm) {
+  if (be_top(vm) > 0) {
+    re_cache *cache = (re_cache*) be_tocomptr(vm, 1);
+    if (cache != NULL) {
+      for (int i = 0; i < BE_RE_CACHE_SIZE; i++) {
+        re_prog_free(cache->entries[i].prog);
+        be_os_free(cache->entries[i].key);
+      }
+      be_os_free(cache);
+    }
+  }
+  be_return_nil(vm);
+}
+
+// Get the cache of the VM, created on first use
+//
+// Each VM has its own cache, held by a comobj in the native class table
+// of the VM (a map that the GC always marks), so that it is freed with the VM.
+static re_cache *re_cache_of(bvm *vm) {
+  bvalue key, *v;
+  var_setobj(&key, BE_COMPTR, (void*) &re_cache_key);
+  if (vm->ntvclass == NULL) {
+    vm->ntvclass = be_map_new(vm);
+  }
+  v = be_map_find(vm, vm->ntvclass, &key);
+  if (v != NULL && var_istype(v, BE_COMOBJ)) {
+    return (re_cache*) ((bcommomobj*) var_toobj(v))->data;
+  }
+  re_cache *cache = be_os_malloc(sizeof(re_cache));
+  if (cache == NULL) {
+    be_throw(vm, BE_MALLOC_FAIL);
+  }
+  memset(cache, 0, sizeof(re_cache));
+  be_newcomobj(vm, cache, &re_cache_destroy);   // kept on the stack while inserted
+  be_map_insert(vm, vm->ntvclass, &key, vm->top - 1);
+  be_pop(vm, 1);
+  return cache;
+}
+
+// Get the compiled pattern at stack index `idx`, a string or bytes
+static re_prog *re_cache_get(bvm *vm, int idx) {
+  bbool is_bytes = !be_isstring(vm, idx);
+  size_t len;
+  const char *key;
+  if (is_bytes) {
+    key = (const char*) be_tobytes(vm, idx, &len);
+  } else {
+    key = be_tostring(vm, idx);
+    len = be_strlen(vm, idx);
+  }
+  re_cache *cache = re_cache_of(vm);
+  re_cache_entry *slot = &cache->entries[0];
+  for (int i = 0; i < BE_RE_CACHE_SIZE; i++) {
+    re_cache_entry *e = &cache->entries[i];
+    if (e->prog != NULL && e->is_bytes == is_bytes && e->len == len && memcmp(e->key, key, len) == 0) {
+      e->last_used = ++cache->clock;
+      return e->prog;
+    }
+    if (e->prog == NULL || (slot->prog != NULL && e->last_used < slot->last_used)) {
+      slot = e;     // free or least recently used
+    }
+  }
+  // compile before evicting, in case of error
+  re_prog *prog = is_bytes ? re_prog_copy(vm, key, len) : re_prog_compile(vm, key);
+  char *key_copy = be_os_malloc(len + 1);
+  if (key_copy == NULL) {
+    re_prog_free(prog);
+    be_throw(vm, BE_MALLOC_FAIL);
+  }
+  memcpy(key_copy, key, len);
+  re_prog_free(slot->prog);
+  be_os_free(slot->key);
+  slot->prog = prog;
+  slot->key = key_copy;
+  slot->len = len;
+  slot->is_bytes = is_bytes;
+  slot->last_used = ++cache->clock;
+  return prog;
+}
+
 // Native functions be_const_func()
 // Berry: `re.compile(pattern:string) -> instance(be_pattern)`
 int be_re_compile(bvm *vm) {
   int32_t argc = be_top(vm); // Get the number of arguments
   if (argc >= 1 && be_isstring(vm, 1)) {
     const char * regex_str = be_tostring(vm, 1);
-    int sz = re1_5_sizecode(regex_str);
-    if (sz < 0) {
-      be_raise(vm, "internal_error", "error in regex");
-    }
-
-    ByteProg *code = be_os_malloc(sizeof(ByteProg) + sz);
-    if (code == NULL) {
-      be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-    }
-    int ret = re1_5_compilecode(code, regex_str);
-    if (ret != 0) {
-      be_raise(vm, "internal_error", "error in regex");
-    }
+    re_prog *prog = re_prog_compile(vm, regex_str);
     be_pushntvclass(vm, &be_class_re_pattern);
     be_call(vm, 0);
-    be_newcomobj(vm, code, &be_commonobj_destroy_generic);
+    be_newcomobj(vm, prog, &re_prog_destroy);
     be_setmember(vm, -2, "_p");
     be_pop(vm, 1);
     be_return(vm);
@@ -85,14 +250,14 @@ int be_re_compilebytes(bvm *vm) {
 
 // pushes either a list if matched, else `nil`
 // return index of next offset, or -1 if not found
-const char *be_re_match_search_run(bvm *vm, ByteProg *code, const char *hay, bbool is_anchored, bbool size_only) {
+const char *be_re_match_search_run(bvm *vm, re_prog *prog, const char *hay, bbool is_anchored, bbool size_only) {
   Subject subj = {hay, hay + strlen(hay)};
 
-  int sub_els = (code->sub + 1) * 2;
+  int sub_els = (prog->code->sub + 1) * 2;
   const char *sub[sub_els];
   memset(sub, 0, sub_els * sizeof sub[0]);
 
-  if (!re1_5_recursiveloopprog(code, &subj, sub, sub_els, is_anchored)) {
+  if (!re_prog_run(prog, &subj, sub, sub_els, is_anchored)) {
     be_pushnil(vm);
     return NULL;    // no match
   }
@@ -120,7 +285,6 @@ int be_re_match_search(bvm *vm, bbool is_anchored, bbool size_only) {
   int32_t argc = be_top(vm); // Get the number of arguments
   if (argc >= 2 && (be_isstring(vm, 1) || be_isbytes(vm, 1)) && be_isstring(vm, 2)) {
     const char * hay = be_tostring(vm, 2);
-    ByteProg *code = NULL;
 
     int32_t offset = 0;
     if (argc >= 3 && be_isint(vm, 3)) {
@@ -131,31 +295,9 @@ int be_re_match_search(bvm *vm, bbool is_anchored, bbool size_only) {
     if (offset >= hay_len) { be_return_nil(vm); }      // any match of empty string returns nil, this catches implicitly when hay_len == 0
     hay += offset;                  // shift to offset
 
-    if (be_isstring(vm, 1)) {
-      const char * regex_str = be_tostring(vm, 1);
-      int sz = re1_5_sizecode(regex_str);
-      if (sz < 0) {
-        be_raise(vm, "internal_error", "error in regex");
-      }
-
-      code = be_os_malloc(sizeof(ByteProg) + sz);
-      if (code == NULL) {
-        be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-      }
-      int ret = re1_5_compilecode(code, regex_str);
-      if (ret != 0) {
-        be_os_free(code);
-        be_raise(vm, "internal_error", "error in regex");
-      }
-    } else {
-      code = (ByteProg *) be_tobytes(vm, 1, NULL);
-    }
+    re_prog *prog = re_cache_get(vm, 1);
     // do the match
-    be_re_match_search_run(vm, code, hay, is_anchored, size_only);
-    // cleanup
-    if (be_isstring(vm, 1)) {
-      be_os_free(code);
-    }
+    be_re_match_search_run(vm, prog, hay, is_anchored, size_only);
     be_return(vm);
   }
   be_raise(vm, "type_error", NULL);
@@ -165,45 +307,22 @@ int be_re_match_search_all(bvm *vm, bbool is_anchored) {
   int32_t argc = be_top(vm); // Get the number of arguments
   if (argc >= 2 && (be_isstring(vm, 1) || be_isbytes(vm, 1)) && be_isstring(vm, 2)) {
     const char * hay = be_tostring(vm, 2);
-    ByteProg *code = NULL;
     int limit = -1;
     if (argc >= 3) {
       limit = be_toint(vm, 3);
     }
 
-    if (be_isstring(vm, 1)) {
-      const char * regex_str = be_tostring(vm, 1);
-      int sz = re1_5_sizecode(regex_str);
-      if (sz < 0) {
-        be_raise(vm, "internal_error", "error in regex");
-      }
-
-      code = be_os_malloc(sizeof(ByteProg) + sz);
-      if (code == NULL) {
-        be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-      }
-      int ret = re1_5_compilecode(code, regex_str);
-      if (ret != 0) {
-        be_os_free(code);
-        be_raise(vm, "internal_error", "error in regex");
-      }
-    } else {
-      code = (ByteProg *) be_tobytes(vm, 1, NULL);
-    }
+    re_prog *prog = re_cache_get(vm, 1);
 
     be_newobject(vm, "list");
     for (int i = limit; i != 0 && hay != NULL; i--) {
-      hay = be_re_match_search_run(vm, code, hay, is_anchored, bfalse);
+      hay = be_re_match_search_run(vm, prog, hay, is_anchored, bfalse);
       if (hay != NULL) {
         be_data_push(vm, -2);   // add sub list to list
       }
       be_pop(vm, 1);
     }
     be_pop(vm, 1);
-    // cleanup
-    if (be_isstring(vm, 1)) {
-      be_os_free(code);
-    }
     be_return(vm);
   }
   be_raise(vm, "type_error", NULL);
@@ -260,8 +379,8 @@ int re_pattern_search(bvm *vm) {
     if (offset >= hay_len) { be_return_nil(vm); }      // any match of empty string returns nil, this catches implicitly when hay_len == 0
     hay += offset;                  // shift to offset
     be_getmember(vm, 1, "_p");
-    ByteProg * code = (ByteProg*) be_tocomptr(vm, -1);
-    be_re_match_search_run(vm, code, hay, bfalse, bfalse);
+    re_prog * prog = (re_prog*) be_tocomptr(vm, -1);
+    be_re_match_search_run(vm, prog, hay, bfalse, bfalse);
     be_return(vm);
   }
   be_raise(vm, "type_error", NULL);
@@ -273,7 +392,7 @@ int re_pattern_match_search_all(bvm *vm, bbool is_anchored) {
   if (argc >= 2 && be_isstring(vm, 2)) {
     const char * hay = be_tostring(vm, 2);
     be_getmember(vm, 1, "_p");
-    ByteProg * code = (ByteProg*) be_tocomptr(vm, -1);
+    re_prog * prog = (re_prog*) be_tocomptr(vm, -1);
     int limit = -1;
     if (argc >= 3) {
       limit = be_toint(vm, 3);
@@ -281,7 +400,7 @@ int re_pattern_match_search_all(bvm *vm, bbool is_anchored) {
 
     be_newobject(vm, "list");
     for (int i = limit; i != 0 && hay != NULL; i--) {
-      hay = be_re_match_search_run(vm, code, hay, is_anchored, bfalse);
+      hay = be_re_match_search_run(vm, prog, hay, is_anchored, bfalse);
       if (hay != NULL) {
         be_data_push(vm, -2);   // add sub list to list
       }
@@ -317,8 +436,8 @@ int re_pattern_match_size(bvm *vm, bbool size_only) {
     if (offset >= hay_len) { be_return_nil(vm); }      // any match of empty string returns nil, this catches implicitly when hay_len == 0
     hay += offset;                  // shift to offset
     be_getmember(vm, 1, "_p");
-    ByteProg * code = (ByteProg*) be_tocomptr(vm, -1);
-    be_re_match_search_run(vm, code, hay, btrue, size_only);
+    re_prog * prog = (re_prog*) be_tocomptr(vm, -1);
+    be_re_match_search_run(vm, prog, hay, btrue, size_only);
     be_return(vm);
   }
   be_raise(vm, "type_error", NULL);
@@ -334,15 +453,15 @@ int re_pattern_match2(bvm *vm) {
   return re_pattern_match_size(vm, btrue);
 }
 
-int re_pattern_split_run(bvm *vm, ByteProg *code, const char *hay, int split_limit) {
+int re_pattern_split_run(bvm *vm, re_prog *prog, const char *hay, int split_limit) {
   Subject subj = {hay, hay + strlen(hay)};
 
-  int sub_els = (code->sub + 1) * 2;
+  int sub_els = (prog->code->sub + 1) * 2;
   const char *sub[sub_els];
 
   be_newobject(vm, "list");
   while (1) {
-    if (split_limit == 0 || !re1_5_recursiveloopprog(code, &subj, sub, sub_els, bfalse)) {
+    if (split_limit == 0 || !re_prog_run(prog, &subj, sub, sub_els, bfalse)) {
       be_pushnstring(vm, subj.begin, subj.end - subj.begin);
       be_data_push(vm, -2);
       be_pop(vm, 1);
@@ -372,9 +491,9 @@ int re_pattern_split(bvm *vm) {
     }
     const char * hay = be_tostring(vm, 2);
     be_getmember(vm, 1, "_p");
-    ByteProg * code = (ByteProg*) be_tocomptr(vm, -1);
+    re_prog * prog = (re_prog*) be_tocomptr(vm, -1);
 
-    return re_pattern_split_run(vm, code, hay, split_limit);
+    return re_pattern_split_run(vm, prog, hay, split_limit);
   }
   be_raise(vm, "type_error", NULL);
 }
@@ -384,35 +503,12 @@ int be_re_split(bvm *vm) {
   int32_t argc = be_top(vm); // Get the number of arguments
   if (argc >= 2 && (be_isstring(vm, 1) || be_isbytes(vm, 1)) && be_isstring(vm, 2)) {
     const char * hay = be_tostring(vm, 2);
-    ByteProg *code = NULL;
     int split_limit = -1;
     if (argc >= 3) {
       split_limit = be_toint(vm, 3);
     }
-    if (be_isstring(vm, 1)) {
-      const char * regex_str = be_tostring(vm, 1);
-      int sz = re1_5_sizecode(regex_str);
-      if (sz < 0) {
-        be_raise(vm, "internal_error", "error in regex");
-      }
-
-      code = be_os_malloc(sizeof(ByteProg) + sz);
-      if (code == NULL) {
-        be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-      }
-      int ret = re1_5_compilecode(code, regex_str);
-      if (ret != 0) {
-        be_os_free(code);
-        be_raise(vm, "internal_error", "error in regex");
-      }
-    } else {
-      code = (ByteProg *) be_tobytes(vm, 1, NULL);
-    }
-    int ret = re_pattern_split_run(vm, code, hay, split_limit);
-    if (be_isstring(vm, 1)) {
-      be_os_free(code);
-    }
-    return ret;
+    re_prog *prog = re_cache_get(vm, 1);
+    return re_pattern_split_run(vm, prog, hay, split_limit);
   }
   be_raise(vm, "type_error", NULL);
 }
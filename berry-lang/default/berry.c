@@ -278,10 +278,23 @@ static int load_script(bvm *vm, int argc, char *argv[], int args, const char * s
     return res;
 }
 
-/* compile the source code to a bytecode file */
-static int build_file(bvm *vm, const char *dst, const char *src, int args)
+/* compile the source code to a bytecode file
+ * the 'script' source string is executed first, so that it can declare
+ * the globals used by the file */
+static int build_file(bvm *vm, const char *dst, const char *src, int args, const char *script)
 {
-    int res = be_loadmode(vm, src, args & arg_l); /* compile script file */
+    int res;
+    if (script) {
+        res = be_loadstring(vm, script);
+        if (res == BE_OK) {
+            res = be_pcall(vm, 0);
+        }
+        res = handle_result(vm, res);
+        if (res != BE_OK) {
+            return res;
+        }
+    }
+    res = be_loadmode(vm, src, args & arg_l); /* compile script file */
     if (res == BE_OK) {
         if (!dst) dst = "a.out"; /* the default output file name */
         res = be_savecode(vm, dst); /* save bytecode file */
@@ -431,7 +444,7 @@ static int analysis_args(bvm *vm, int argc, char *argv[])
         if (!opt.src && argc > 0) {
             opt.src = *argv;
         }
-        return build_file(vm, opt.dst, opt.src, args);
+        return build_file(vm, opt.dst, opt.src, args, opt.execute);
     }
     return load_script(vm, argc, argv, args, opt.execute);
 }
@@ -73,9 +73,11 @@
  * 0: unable to output source file and line number at runtime.
  * 1: output source file and line number information at runtime.
  * 2: the information use uint16_t type (save space).
- * Default: 1
+ * Default: 0, 1 in the profiling build (`make profile`)
  **/
+#ifndef BE_DEBUG_RUNTIME_INFO
 #define BE_DEBUG_RUNTIME_INFO           0
+#endif
 
 /* Macro: BE_DEBUG_VAR_INFO
  * Set variable debugging tracking information.
@@ -100,6 +102,21 @@
  **/
 #define BE_VM_OBSERVABILITY_SAMPLING    20
 
+/* Macro: BE_USE_PROFILER
+ * Enable the sampling profiler and the `profiler` module.
+ * The VM records the Berry call stack every N instructions,
+ * or on a SIGPROF timer on POSIX hosts. Samples are reported
+ * per function, per line and as collapsed stacks for flame
+ * graphs. Line numbers need BE_DEBUG_RUNTIME_INFO.
+ * The VM then tests a countdown at each instruction, so the
+ * profiler is only enabled by the profiling build, which
+ * defines this macro in berry_conf_profile.h (`make profile`).
+ * Default: 0
+ **/
+#ifndef BE_USE_PROFILER
+#define BE_USE_PROFILER                 0
+#endif
+
 /* Macro: BE_STACK_TOTAL_MAX
  * Set the maximum total stack size.
  * Default: 20000
@@ -130,12 +147,22 @@
  **/
 #define BE_CONST_SEARCH_SIZE            255
 
-/* Macro: BE_STACK_FREE_MIN
- * The short string will hold the hash value when the value is
- * true. It may be faster but requires more RAM.
+/* Macro: BE_USE_STR_HASH_CACHE
+ * The strings created at runtime will hold their hash value when the
+ * value is true, long strings compute it on first use. It may be
+ * faster but requires more RAM.
  * Default: 0
  **/
-#define BE_USE_STR_HASH_CACHE           0
+#define BE_USE_STR_HASH_CACHE           1
+
+/* Macro: BE_USE_MAP_INDEX
+ * Maps created at runtime with more than 8 slots get an open addressing
+ * index of hash tags when BE_USE_MAP_INDEX is not 0, lookups compare a
+ * tag byte per probe instead of following the collision chain. The index
+ * takes 3 bytes per bucket, with 1.5 to 3 buckets per slot.
+ * Default: 0
+ **/
+#define BE_USE_MAP_INDEX                1
 
 /* Macro: BE_USE_FILE_SYSTEM
  * The file system interface will be used when this macro is true
@@ -166,6 +193,19 @@
  **/
 #define BE_USE_BYTECODE_LOADER          1
 
+/* Macro: BE_USE_BYTECODE_MMAP
+ * Map bytecode files in memory with be_fmap() when BE_USE_BYTECODE_MMAP
+ * is not 0, instructions are then executed in place instead of being
+ * copied to the heap. The port must implement be_fmap() and be_funmap().
+ * A file stays mapped until the VM is deleted, and must not be rewritten
+ * or truncated while it is mapped: the VM would run the new content or
+ * crash. Only enable it when .bec files are not replaced at runtime.
+ * Saved files then use bytecode version 5, with the instructions aligned
+ * for in-place execution. Upstream Berry only loads version 4.
+ * Default: 0
+ **/
+#define BE_USE_BYTECODE_MMAP            0
+
 /* Macro: BE_USE_SHARED_LIB
  * Enable shared library  when BE_USE_SHARED_LIB is not 0,
  * otherwise disable the feature.
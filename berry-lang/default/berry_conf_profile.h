@@ -0,0 +1,18 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+/* Configuration of the profiling build (`make profile`)
+ * Forced before berry_conf.h with `-include` and passed to coc after
+ * it, so the `profiler` module gets its constant tables.
+ **/
+#ifndef BERRY_CONF_PROFILE_H
+#define BERRY_CONF_PROFILE_H
+
+#define BE_USE_PROFILER                 1
+#define BE_DEBUG_RUNTIME_INFO           1
+
+#endif
@@ -1,4 +1,12 @@
 extern const bcstring be_const_str_;
+extern const bcstring be_const_str_CHUNK_RECORDS;
+extern const bcstring be_const_str_END_ARRAY;
+extern const bcstring be_const_str_END_OBJECT;
+extern const bcstring be_const_str_KEY;
+extern const bcstring be_const_str_RECORD_SIZE;
+extern const bcstring be_const_str_START_ARRAY;
+extern const bcstring be_const_str_START_OBJECT;
+extern const bcstring be_const_str_VALUE;
 extern const bcstring be_const_str__X21_X3D;
 extern const bcstring be_const_str__X28_X29;
 extern const bcstring be_const_str__X2B;
@@ -24,6 +32,7 @@ extern const bcstring be_const_str_allocated;
 extern const bcstring be_const_str_allocs;
 extern const bcstring be_const_str_append;
 extern const bcstring be_const_str_appendb64;
+extern const bcstring be_const_str_appendf;
 extern const bcstring be_const_str_appendhex;
 extern const bcstring be_const_str_as;
 extern const bcstring be_const_str_asin;
@@ -32,8 +41,10 @@ extern const bcstring be_const_str_asstring;
 extern const bcstring be_const_str_atan;
 extern const bcstring be_const_str_atan2;
 extern const bcstring be_const_str_attrdump;
+extern const bcstring be_const_str_bisect;
 extern const bcstring be_const_str_bool;
 extern const bcstring be_const_str_break;
+extern const bcstring be_const_str_builder;
 extern const bcstring be_const_str_byte;
 extern const bcstring be_const_str_bytes;
 extern const bcstring be_const_str_call;
@@ -74,7 +85,9 @@ extern const bcstring be_const_str_except;
 extern const bcstring be_const_str_exists;
 extern const bcstring be_const_str_exit;
 extern const bcstring be_const_str_exp;
+extern const bcstring be_const_str_extend;
 extern const bcstring be_const_str_false;
+extern const bcstring be_const_str_fill;
 extern const bcstring be_const_str_find;
 extern const bcstring be_const_str_floor;
 extern const bcstring be_const_str_for;
@@ -105,6 +118,7 @@ extern const bcstring be_const_str_inf;
 extern const bcstring be_const_str_init;
 extern const bcstring be_const_str_input;
 extern const bcstring be_const_str_insert;
+extern const bcstring be_const_str_insort;
 extern const bcstring be_const_str_int;
 extern const bcstring be_const_str_isdir;
 extern const bcstring be_const_str_isfile;
@@ -161,6 +175,10 @@ extern const bcstring be_const_str_resize;
 extern const bcstring be_const_str_return;
 extern const bcstring be_const_str_reverse;
 extern const bcstring be_const_str_round;
+extern const bcstring be_const_str_scale_int;
+extern const bcstring be_const_str_scale_uint;
+extern const bcstring be_const_str_scale_uint_buf;
+extern const bcstring be_const_str_scan;
 extern const bcstring be_const_str_search;
 extern const bcstring be_const_str_searchall;
 extern const bcstring be_const_str_set;
@@ -173,9 +191,12 @@ extern const bcstring be_const_str_setmember;
 extern const bcstring be_const_str_setmodule;
 extern const bcstring be_const_str_setrange;
 extern const bcstring be_const_str_sin;
+extern const bcstring be_const_str_sine_int;
 extern const bcstring be_const_str_sinh;
 extern const bcstring be_const_str_size;
+extern const bcstring be_const_str_slice;
 extern const bcstring be_const_str_solidified;
+extern const bcstring be_const_str_sort;
 extern const bcstring be_const_str_split;
 extern const bcstring be_const_str_splitext;
 extern const bcstring be_const_str_sqrt;
@@ -183,6 +204,7 @@ extern const bcstring be_const_str_srand;
 extern const bcstring be_const_str_startswith;
 extern const bcstring be_const_str_static;
 extern const bcstring be_const_str_str;
+extern const bcstring be_const_str_string_builder;
 extern const bcstring be_const_str_super;
 extern const bcstring be_const_str_system;
 extern const bcstring be_const_str_tan;
@@ -0,0 +1,24 @@
+#include "be_constobj.h"
+
+static be_define_const_map_slots(be_class_string_builder_map) {
+    { be_const_key(_X2E_X2E, 7), be_const_func(sb_append) },
+    { be_const_key(append, -1), be_const_func(sb_append) },
+    { be_const_key(clear, -1), be_const_func(sb_clear) },
+    { be_const_key(_X2Ep, 6), be_const_var(0) },
+    { be_const_key(size, -1), be_const_func(sb_size) },
+    { be_const_key(tostring, 0), be_const_func(sb_tostring) },
+    { be_const_key(init, -1), be_const_func(sb_init) },
+    { be_const_key(appendf, -1), be_const_func(sb_appendf) },
+};
+
+static be_define_const_map(
+    be_class_string_builder_map,
+    8
+);
+
+BE_EXPORT_VARIABLE be_define_const_class(
+    be_class_string_builder,
+    1,
+    NULL,
+    string_builder
+);
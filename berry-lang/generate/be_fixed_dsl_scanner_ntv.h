@@ -0,0 +1,19 @@
+#include "be_constobj.h"
+
+static be_define_const_map_slots(m_libdsl_scanner_ntv_map) {
+    { be_const_key(RECORD_SIZE, 1), be_const_int(SCAN_RECORD_SIZE) },
+    { be_const_key(CHUNK_RECORDS, 2), be_const_int(SCAN_CHUNK_RECORDS) },
+    { be_const_key(scan, -1), be_const_func(m_scan) },
+};
+
+static be_define_const_map(
+    m_libdsl_scanner_ntv_map,
+    3
+);
+
+static be_define_const_module(
+    m_libdsl_scanner_ntv,
+    "dsl_scanner_ntv"
+);
+
+BE_EXPORT_VARIABLE be_define_const_native_module(dsl_scanner_ntv);
@@ -1,13 +1,20 @@
 #include "be_constobj.h"
 
 static be_define_const_map_slots(m_libjson_map) {
+    { be_const_key(VALUE, -1), be_const_int(JSON_VALUE) },
+    { be_const_key(START_ARRAY, 5), be_const_int(JSON_START_ARRAY) },
+    { be_const_key(KEY, -1), be_const_int(JSON_KEY) },
+    { be_const_key(scan, -1), be_const_func(m_json_scan) },
+    { be_const_key(load, -1), be_const_func(m_json_load) },
+    { be_const_key(END_ARRAY, 7), be_const_int(JSON_END_ARRAY) },
+    { be_const_key(START_OBJECT, -1), be_const_int(JSON_START_OBJECT) },
+    { be_const_key(END_OBJECT, -1), be_const_int(JSON_END_OBJECT) },
     { be_const_key(dump, -1), be_const_func(m_json_dump) },
-    { be_const_key(load, 0), be_const_func(m_json_load) },
 };
 
 static be_define_const_map(
     m_libjson_map,
-    2
+    9
 );
 
 static be_define_const_module(
@@ -0,0 +1,2 @@
+#include "be_constobj.h"
+
@@ -0,0 +1,20 @@
+#include "be_constobj.h"
+
+static be_define_const_map_slots(m_libtasmota_ntv_map) {
+    { be_const_key(scale_uint_buf, -1), be_const_func(m_scale_uint_buf) },
+    { be_const_key(scale_uint, -1), be_const_func(m_scale_uint) },
+    { be_const_key(sine_int, 1), be_const_func(m_sine_int) },
+    { be_const_key(scale_int, -1), be_const_func(m_scale_int) },
+};
+
+static be_define_const_map(
+    m_libtasmota_ntv_map,
+    4
+);
+
+static be_define_const_module(
+    m_libtasmota_ntv,
+    "tasmota_ntv"
+);
+
+BE_EXPORT_VARIABLE be_define_const_native_module(tasmota_ntv);
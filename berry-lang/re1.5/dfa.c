@@ -0,0 +1,484 @@
+// Copyright 2026 Berry authors.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Lazily built DFA for programs without captures.
+//
+// States are built on demand by subset construction over the Pike VM threads
+// and kept in a bounded cache, which is flushed when full. The forward
+// automaton keeps threads in priority order and drops the threads after a
+// Match like the Pike VM does, so it finds the same match end as the
+// backtracker. For a search, the start of the match is then found by running
+// the reversed program backward from the end: the match starts at the
+// leftmost position from which the pattern matches.
+//
+// All the buffers are allocated with the DFA, matching uses no stack space
+// that depends on the size of the pattern.
+
+#include "re1.5.h"
+#include "be_mem.h"
+
+typedef unsigned short u16;
+
+#define UNKNOWN     0xffff      // transition not computed yet
+#define AT_BEGIN    1           // position is the beginning of the subject
+#define AT_END      2           // position is the end of the subject
+
+typedef struct Cache Cache;
+struct Cache
+{
+    int nstates;
+    int maxstates;
+    int stride;         // u16 per state: length, match flag, list, transitions
+    int start;          // cached start state, -1 if none
+    u16 *states;
+};
+
+struct DFA
+{
+    int ninst;
+    int entry;          // first instruction after the non-anchored prefix
+    int nclasses;
+    int asserts;        // program contains Bol or Eol
+    unsigned char classmap[256];
+    unsigned char *op;  // per instruction
+    u16 *next;          // following instruction
+    u16 *target;        // jump target
+    unsigned char *accept;  // consumer instruction x class -> matches
+    u16 *predstart;     // epsilon predecessors, ninst + 1 offsets into pred
+    u16 *pred;
+    unsigned char *mark;
+    u16 *list;
+    u16 *state;         // copy of the instructions of a forward state
+    unsigned char *in;  // instructions of a reverse state
+    Cache fwd[2];       // forward automata, non-anchored and anchored
+    Cache rev;
+};
+
+static int
+inst_len(const char *pc)
+{
+    switch (*pc & 0x7f) {
+    case Class:
+    case ClassNot:
+        return 2 + (unsigned char)pc[1] * 2;
+    case Char:
+    case NamedClass:
+    case Jmp:
+    case Split:
+    case RSplit:
+    case Save:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+static int
+inst_match(const char *pc, char c)
+{
+    switch (*pc & 0x7f) {
+    case Char:
+        return c == pc[1];
+    case Any:
+        return 1;
+    case Class:
+    case ClassNot:
+        return _re1_5_classmatch(pc + 1, &c);
+    case NamedClass:
+        return _re1_5_namedclassmatch(pc + 1, &c);
+    }
+    return 0;
+}
+
+static void
+cache_reset(Cache *c)
+{
+    c->nstates = 0;
+    c->start = -1;
+}
+
+static int
+cache_init(Cache *c, int stride, int size)
+{
+    c->stride = stride;
+    c->maxstates = size / (stride * (int)sizeof(u16));
+    if (c->maxstates < 4)
+        return 0;
+    if (c->maxstates > UNKNOWN)
+        c->maxstates = UNKNOWN;
+    c->states = be_os_malloc(c->maxstates * stride * sizeof(u16));
+    cache_reset(c);
+    return c->states != nil;
+}
+
+// Find or add the state with 'n' instructions in d->list
+static int
+cache_state(DFA *d, Cache *c, int n, int match)
+{
+    int i, j;
+    u16 *s;
+    for (i = 0; i < c->nstates; i++) {
+        s = c->states + i * c->stride;
+        if (s[0] == n && s[1] == match && !memcmp(s + 2, d->list, n * sizeof(u16)))
+            return i;
+    }
+    if (c->nstates == c->maxstates)
+        cache_reset(c);     // flush, the caller must not keep state indexes
+    s = c->states + c->nstates * c->stride;
+    s[0] = n;
+    s[1] = match;
+    memcpy(s + 2, d->list, n * sizeof(u16));
+    for (j = 0; j < d->nclasses; j++)
+        s[2 + d->ninst + j] = UNKNOWN;
+    return c->nstates++;
+}
+
+// Follow the epsilon transitions from 'i' in priority order, like addthread()
+static void
+fwd_add(DFA *d, int i, int ctx, int *n)
+{
+    if (d->mark[i])
+        return;
+    d->mark[i] = 1;
+    switch (d->op[i]) {
+    case Jmp:
+        fwd_add(d, d->target[i], ctx, n);
+        break;
+    case Split:
+        fwd_add(d, d->next[i], ctx, n);
+        fwd_add(d, d->target[i], ctx, n);
+        break;
+    case RSplit:
+        fwd_add(d, d->target[i], ctx, n);
+        fwd_add(d, d->next[i], ctx, n);
+        break;
+    case Save:
+        fwd_add(d, d->next[i], ctx, n);
+        break;
+    case Bol:
+        if (ctx & AT_BEGIN)
+            fwd_add(d, d->next[i], ctx, n);
+        break;
+    case Eol:
+        if (ctx & AT_END)
+            fwd_add(d, d->next[i], ctx, n);
+        break;
+    default:
+        d->list[(*n)++] = i;
+        break;
+    }
+}
+
+// Make a forward state from d->list, threads after a Match never run
+static int
+fwd_state(DFA *d, Cache *c, int n)
+{
+    int i;
+    for (i = 0; i < n; i++) {
+        if (d->op[d->list[i]] == Match)
+            return cache_state(d, c, i, 1);
+    }
+    return cache_state(d, c, n, 0);
+}
+
+static int
+fwd_start(DFA *d, Cache *c, int entry, int ctx)
+{
+    int n = 0;
+    memset(d->mark, 0, d->ninst);
+    fwd_add(d, entry, ctx, &n);
+    return fwd_state(d, c, n);
+}
+
+static int
+fwd_step(DFA *d, Cache *c, int s, int cls, int ctx)
+{
+    u16 *st = c->states + s * c->stride;
+    u16 *cur = st + 2;
+    u16 *buf = d->state;
+    int i, n = 0, len = st[0], r;
+
+    if (!(ctx & AT_END) || !d->asserts) {
+        if (st[2 + d->ninst + cls] != UNKNOWN)
+            return st[2 + d->ninst + cls];
+    } else {
+        st = nil;       // context dependent, not cached
+    }
+    memcpy(buf, cur, len * sizeof(u16));   // d->list is overwritten below
+    memset(d->mark, 0, d->ninst);
+    for (i = 0; i < len; i++) {
+        if (d->accept[buf[i] * d->nclasses + cls])
+            fwd_add(d, d->next[buf[i]], ctx, &n);
+    }
+    int before = c->nstates;
+    r = fwd_state(d, c, n);
+    if (st && c->nstates >= before)     // not flushed
+        st[2 + d->ninst + cls] = r;
+    return r;
+}
+
+// Follow the epsilon transitions backward from the marked instructions
+static void
+rev_add(DFA *d, int i, int ctx)
+{
+    int k;
+    if (d->mark[i])
+        return;
+    d->mark[i] = 1;
+    for (k = d->predstart[i]; k < d->predstart[i + 1]; k++) {
+        int p = d->pred[k];
+        if ((d->op[p] == Bol && !(ctx & AT_BEGIN)) || (d->op[p] == Eol && !(ctx & AT_END)))
+            continue;
+        rev_add(d, p, ctx);
+    }
+}
+
+// Make a reverse state from the marked instructions, sorted
+static int
+rev_state(DFA *d)
+{
+    int i, n = 0;
+    for (i = d->entry; i < d->ninst; i++) {
+        if (d->mark[i])
+            d->list[n++] = i;
+    }
+    return cache_state(d, &d->rev, n, d->mark[d->entry]);
+}
+
+static int
+rev_step(DFA *d, int s, int cls, int ctx)
+{
+    Cache *c = &d->rev;
+    u16 *st = c->states + s * c->stride;
+    unsigned char *in = d->in;
+    int i, len = st[0], r;
+
+    if (!(ctx & AT_BEGIN) || !d->asserts) {
+        if (st[2 + d->ninst + cls] != UNKNOWN)
+            return st[2 + d->ninst + cls];
+    } else {
+        st = nil;
+    }
+    memset(in, 0, d->ninst);
+    for (i = 0; i < len; i++)
+        in[c->states[s * c->stride + 2 + i]] = 1;
+    memset(d->mark, 0, d->ninst);
+    for (i = d->entry; i < d->ninst; i++) {
+        if (d->op[i] < ASSERTS && in[d->next[i]] && d->accept[i * d->nclasses + cls])
+            rev_add(d, i, ctx);
+    }
+    int before = c->nstates;
+    r = rev_state(d);
+    if (st && c->nstates >= before)
+        st[2 + d->ninst + cls] = r;
+    return r;
+}
+
+DFA*
+re1_5_dfa_new(ByteProg *prog, int cachesize)
+{
+    DFA *d;
+    int i, j, b, n, pc, ninst = 0, npred = 0;
+    short *index;
+    short (*split)[2];
+
+    if (prog->sub != 0)
+        return nil;     // captures need the backtracker
+    for (pc = 0; pc < prog->bytelen; pc += inst_len(prog->insts + pc))
+        ninst++;
+    if (ninst >= UNKNOWN)
+        return nil;
+
+    d = be_os_malloc(sizeof(DFA));
+    if (d == nil)
+        return nil;
+    memset(d, 0, sizeof(DFA));
+    d->ninst = ninst;
+    d->op = be_os_malloc(ninst);
+    d->next = be_os_malloc(ninst * sizeof(u16));
+    d->target = be_os_malloc(ninst * sizeof(u16));
+    d->mark = be_os_malloc(ninst);
+    d->list = be_os_malloc(ninst * sizeof(u16));
+    d->state = be_os_malloc(ninst * sizeof(u16));
+    d->in = be_os_malloc(ninst);
+    d->predstart = be_os_malloc((ninst + 1) * sizeof(u16));
+    index = be_os_malloc((prog->bytelen + 1) * sizeof(short));
+    split = be_os_malloc(256 * sizeof(*split));
+    if (!d->op || !d->next || !d->target || !d->mark || !d->list || !d->state || !d->in
+        || !d->predstart || !index || !split)
+        goto fail;
+
+    // decode instructions, and map byte offsets to instruction indexes
+    for (pc = 0, i = 0; pc < prog->bytelen; pc += inst_len(prog->insts + pc), i++)
+        index[pc] = i;
+    index[prog->bytelen] = ninst;
+    d->entry = index[NON_ANCHORED_PREFIX];
+    for (pc = 0, i = 0; pc < prog->bytelen; pc += inst_len(prog->insts + pc), i++) {
+        const char *p = prog->insts + pc;
+        int len = inst_len(p);
+        d->op[i] = *p & 0x7f;
+        d->next[i] = index[pc + len];
+        d->target[i] = d->next[i];
+        if (d->op[i] == Jmp || d->op[i] == Split || d->op[i] == RSplit)
+            d->target[i] = index[pc + len + (signed char)p[1]];
+        if (d->op[i] == Bol || d->op[i] == Eol)
+            d->asserts = 1;
+    }
+
+    // split bytes into classes matched by the same instructions
+    memset(d->classmap, 0, sizeof(d->classmap));
+    d->nclasses = 1;
+    for (pc = 0; pc < prog->bytelen; pc += inst_len(prog->insts + pc)) {
+        const char *p = prog->insts + pc;
+        if ((*p & 0x7f) >= ASSERTS || (*p & 0x7f) == Any)
+            continue;
+        memset(split, -1, 256 * sizeof(*split));
+        n = 0;
+        for (b = 0; b < 256; b++) {
+            int m = inst_match(p, (char)b);
+            if (split[d->classmap[b]][m] < 0)
+                split[d->classmap[b]][m] = n++;
+            d->classmap[b] = split[d->classmap[b]][m];
+        }
+        d->nclasses = n;
+    }
+    d->accept = be_os_malloc(ninst * d->nclasses);
+    if (!d->accept)
+        goto fail;
+    for (j = 0; j < d->nclasses; j++) {
+        for (b = 0; d->classmap[b] != j; b++)
+            ;
+        for (pc = 0, i = 0; pc < prog->bytelen; pc += inst_len(prog->insts + pc), i++)
+            d->accept[i * d->nclasses + j] = inst_match(prog->insts + pc, (char)b);
+    }
+
+    // epsilon predecessors, without the non-anchored prefix
+    memset(d->predstart, 0, (ninst + 1) * sizeof(u16));
+    for (i = d->entry; i < ninst; i++) {
+        switch (d->op[i]) {
+        case Split: case RSplit:
+            d->predstart[d->target[i] + 1]++;
+            npred++;
+            // fall through
+        case Save: case Bol: case Eol:
+            d->predstart[d->next[i] + 1]++;
+            npred++;
+            break;
+        case Jmp:
+            d->predstart[d->target[i] + 1]++;
+            npred++;
+            break;
+        }
+    }
+    for (i = 0; i < ninst; i++)
+        d->predstart[i + 1] += d->predstart[i];
+    d->pred = be_os_malloc((npred > 0 ? npred : 1) * sizeof(u16));
+    if (!d->pred)
+        goto fail;
+    {
+        u16 *fill = d->list;    // not used until matching
+        memcpy(fill, d->predstart, ninst * sizeof(u16));
+        for (i = d->entry; i < ninst; i++) {
+            switch (d->op[i]) {
+            case Split: case RSplit:
+                d->pred[fill[d->target[i]]++] = i;
+                // fall through
+            case Save: case Bol: case Eol:
+                d->pred[fill[d->next[i]]++] = i;
+                break;
+            case Jmp:
+                d->pred[fill[d->target[i]]++] = i;
+                break;
+            }
+        }
+    }
+    be_os_free(index);
+    be_os_free(split);
+    index = nil;
+    split = nil;
+
+    n = 2 + ninst + d->nclasses;
+    if (!cache_init(&d->fwd[0], n, cachesize / 3) || !cache_init(&d->fwd[1], n, cachesize / 3)
+        || !cache_init(&d->rev, n, cachesize / 3))
+        goto fail;
+    return d;
+
+fail:
+    be_os_free(index);
+    be_os_free(split);
+    re1_5_dfa_free(d);
+    return nil;
+}
+
+void
+re1_5_dfa_free(DFA *d)
+{
+    if (d == nil)
+        return;
+    be_os_free(d->op);
+    be_os_free(d->next);
+    be_os_free(d->target);
+    be_os_free(d->accept);
+    be_os_free(d->predstart);
+    be_os_free(d->pred);
+    be_os_free(d->mark);
+    be_os_free(d->list);
+    be_os_free(d->state);
+    be_os_free(d->in);
+    be_os_free(d->fwd[0].states);
+    be_os_free(d->fwd[1].states);
+    be_os_free(d->rev.states);
+    be_os_free(d);
+}
+
+// Same results as re1_5_recursiveloopprog() for programs without captures
+int
+re1_5_dfa(DFA *d, Subject *input, const char **subp, int nsubp, int is_anchored)
+{
+    Cache *c = &d->fwd[is_anchored ? 1 : 0];
+    const char *sp, *matched = nil;
+    int s, ctx = AT_BEGIN;
+
+    if (input->begin == input->end) {
+        s = fwd_start(d, c, is_anchored ? d->entry : 0, AT_BEGIN | AT_END);
+    } else {
+        if (c->start < 0)
+            c->start = fwd_start(d, c, is_anchored ? d->entry : 0, AT_BEGIN);
+        s = c->start;
+    }
+    for (sp = input->begin;; sp++) {
+        u16 *st = c->states + s * c->stride;
+        if (st[1])
+            matched = sp;
+        if (st[0] == 0 || sp >= input->end)
+            break;
+        ctx = (sp + 1 == input->end) ? AT_END : 0;
+        s = fwd_step(d, c, s, d->classmap[(unsigned char)*sp], ctx);
+    }
+    if (matched == nil)
+        return 0;
+
+    if (nsubp > 0)
+        subp[0] = input->begin;
+    if (nsubp > 1)
+        subp[1] = matched;
+    if (is_anchored || nsubp == 0)
+        return 1;
+
+    // leftmost start of a match ending at 'matched'
+    memset(d->mark, 0, d->ninst);
+    ctx = (matched == input->begin ? AT_BEGIN : 0) | (matched == input->end ? AT_END : 0);
+    rev_add(d, d->ninst - 1, ctx);      // Match is the last instruction
+    s = rev_state(d);
+    for (sp = matched;; sp--) {
+        u16 *st = d->rev.states + s * d->rev.stride;
+        if (st[1])
+            subp[0] = sp;
+        if (st[0] == 0 || sp <= input->begin)
+            break;
+        ctx = (sp - 1 == input->begin) ? AT_BEGIN : 0;
+        s = rev_step(d, s, d->classmap[(unsigned char)sp[-1]], ctx);
+    }
+    return 1;
+}
@@ -20,6 +20,7 @@ typedef struct Prog Prog;
 typedef struct ByteProg ByteProg;
 typedef struct Inst Inst;
 typedef struct Subject Subject;
+typedef struct DFA DFA;
 
 struct Regexp
 {
@@ -144,6 +145,11 @@ int re1_5_recursiveloopprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_recursiveprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_thompsonvm(ByteProg*, Subject*, const char**, int, int);
 
+// Lazily built DFA for programs without captures, states are kept in 'cachesize' bytes
+DFA *re1_5_dfa_new(ByteProg*, int cachesize);
+void re1_5_dfa_free(DFA*);
+int re1_5_dfa(DFA*, Subject*, const char**, int, int);
+
 // Return codes for re1_5_sizecode() and re1_5_compilecode()
 enum {
     RE1_5_SUCCESS = 0,
@@ -15,6 +15,7 @@
 #include "be_string.h"
 #include "be_map.h"
 #include "be_strlib.h"
+#include "be_byteslib.h"
 #include <string.h>
 
 #define READLINE_STEP       100
@@ -435,10 +436,37 @@ static int m_compile_file(bvm *vm, bbool islocal)
     }
     return raise_compile_error(vm);
 }
+
+#if BE_USE_BYTECODE_LOADER
+/* load a bytecode file image from a bytes() buffer, instructions are copied
+ * except from a mapped or solidified buffer, whose memory must then stay valid
+ * and unchanged for the lifetime of the VM: aligned instructions run in place */
+static int m_compile_bytecode(bvm *vm)
+{
+    size_t len;
+    const void *buf = be_tobytes(vm, 1, &len);
+    bbool shared;
+    int res;
+    be_getmember(vm, 1, ".size");
+    shared = be_toint(vm, -1) == BYTES_SIZE_MAPPED || be_toint(vm, -1) == BYTES_SIZE_SOLIDIFIED;
+    be_pop(vm, 1);
+    res = be_loadbytecode(vm, buf, len, shared);
+    if (res == BE_OK) {
+        be_return(vm);
+    }
+    return raise_compile_error(vm);
+}
+#endif
 #endif
 
 int be_baselib_compile(bvm *vm)
 {
+#if BE_USE_BYTECODE_LOADER && BE_USE_SCRIPT_COMPILER
+    if (be_top(vm) >= 2 && be_isbytes(vm, 1) && be_isstring(vm, 2)
+            && !strcmp(be_tostring(vm, 2), "bytecode")) {
+        return m_compile_bytecode(vm);
+    }
+#endif
 #if BE_USE_SCRIPT_COMPILER
     if (be_top(vm) && be_isstring(vm, 1)) {
         if (be_top(vm) >= 2 && be_isstring(vm, 2)) {
@@ -23,7 +23,13 @@
 #define MAGIC_NUMBER1       0xBE
 #define MAGIC_NUMBER2       0xCD
 #define MAGIC_NUMBER3       0xFE
-#define BYTECODE_VERSION    4
+#if BE_USE_BYTECODE_MMAP
+#define BYTECODE_VERSION    5   /* instructions aligned to run in mapped files */
+#else
+#define BYTECODE_VERSION    4   /* format of upstream Berry */
+#endif
+#define BYTECODE_VERSION_MIN 4  /* oldest version that can be loaded */
+#define BYTECODE_VERSION_MAX 5  /* newest version that can be loaded */
 
 #define USE_64BIT_INT       (BE_INTGER_TYPE == 2 \
     || BE_INTGER_TYPE == 1 && LONG_MAX == 9223372036854775807L)
@@ -190,11 +196,28 @@ static void save_value(bvm *vm, void *fp, bvalue *v)
     }
 }
 
+#if BYTECODE_VERSION >= 5
+/* align the instructions on 4 bytes in the file, so that a mapped file
+ * can be executed in place */
+static void save_code_padding(void *fp)
+{
+    long pos = be_ftell(fp);
+    uint8_t pad = pos >= 0 ? (uint8_t)((4 - ((pos + 1) & 3)) & 3) : 0;
+    save_byte(fp, pad);
+    while (pad--) {
+        save_byte(fp, 0);
+    }
+}
+#endif
+
 static void save_bytecode(bvm *vm, void *fp, bproto *proto)
 {
     int forbid_gbl = comp_is_named_gbl(vm);
     binstruction *code = proto->code, *end;
     save_long(fp, (uint32_t)proto->codesize);
+#if BYTECODE_VERSION >= 5
+    save_code_padding(fp);
+#endif
     for (end = code + proto->codesize; code < end; ++code) {
         save_long(fp, (uint32_t)*code);
         if (forbid_gbl) {   /* we are saving only named globals, so make sure we don't save OP_GETGBL or OP_SETGBL */
@@ -256,7 +279,7 @@ static void save_proto(bvm *vm, void *fp, bproto *proto)
 #endif
         save_byte(fp, proto->argc); /* argc */
         save_byte(fp, proto->nstack); /* nstack */
-        save_byte(fp, proto->varg); /* varg */
+        save_byte(fp, proto->varg & ~BE_VA_SHARED_CODE); /* varg */
         save_byte(fp, 0x00); /* reserved */
         save_bytecode(vm, fp, proto); /* bytecode */
         save_constants(vm, fp, proto); /* constant */
@@ -318,52 +341,99 @@ void be_bytecode_save(bvm *vm, const char *filename, bproto *proto)
 #endif /* BE_USE_BYTECODE_SAVER */
 
 #if BE_USE_BYTECODE_LOADER
-static bbool load_proto(bvm *vm, void *fp, bproto **proto, int info, int version);
+/* how the loader uses the bytecode buffer */
+#define LOAD_COPY           0   /* temporary buffer, everything is copied */
+#define LOAD_SHARED         1   /* read-only buffer that outlives the VM, instructions
+                                 * that need no relocation are executed in place */
+#define LOAD_MAPPED         2   /* private writable mapping kept until the VM is deleted,
+                                 * instructions are relocated and executed in place */
+
+/* reader over a bytecode buffer, reads are bounds-checked: past the end
+ * they return zeros and set the error message, so that loading stops */
+typedef struct {
+    const uint8_t *p;           /* read position */
+    const uint8_t *end;         /* end of buffer */
+    int mode;                   /* LOAD_COPY, LOAD_SHARED or LOAD_MAPPED */
+    int version;                /* bytecode version */
+    const char *msg;            /* error message, or NULL */
+    size_t inplace;             /* size of instructions executed in place */
+} bcreader;
+
+static bbool load_proto(bvm *vm, bcreader *r, bproto **proto, int info);
+
+static void reader_init(bcreader *r, const void *buffer, size_t size, int mode)
+{
+    r->p = buffer;
+    r->end = r->p + size;
+    r->mode = mode;
+    r->version = 0;
+    r->msg = NULL;
+    r->inplace = 0;
+}
+
+/* get 'count' elements of 'size' bytes and advance, or NULL if beyond the end */
+static const uint8_t* load_block(bcreader *r, size_t count, size_t size)
+{
+    if (r->msg == NULL && count <= (size_t)(r->end - r->p) / size) {
+        const uint8_t *p = r->p;
+        r->p += count * size;
+        return p;
+    }
+    if (r->msg == NULL) {
+        r->msg = "truncated bytecode.";
+    }
+    r->p = r->end;
+    return NULL;
+}
 
-static uint8_t load_byte(void *fp)
+static uint32_t decode_long(const uint8_t *p)
 {
-    uint8_t buffer[1];
-    if (be_fread(fp, buffer, sizeof(buffer)) == sizeof(buffer)) {
-        return buffer[0];
-    }
-    return 0;
+    return ((uint32_t)p[3] << 24)
+        | ((uint32_t)p[2] << 16)
+        | ((uint32_t)p[1] << 8)
+        | p[0];
 }
 
-static uint16_t load_word(void *fp)
+static uint8_t load_byte(bcreader *r)
 {
-    uint8_t buffer[2];
-    if (be_fread(fp, buffer, sizeof(buffer)) == sizeof(buffer)) {
-        return ((uint16_t)buffer[1] << 8) | buffer[0];
-    }
-    return 0;
+    const uint8_t *p = load_block(r, 1, 1);
+    return p ? p[0] : 0;
 }
 
-static uint32_t load_long(void *fp)
+static uint16_t load_word(bcreader *r)
 {
-    uint8_t buffer[4];
-    if (be_fread(fp, buffer, sizeof(buffer)) == sizeof(buffer)) {
-        return ((uint32_t)buffer[3] << 24)
-            | ((uint32_t)buffer[2] << 16)
-            | ((uint32_t)buffer[1] << 8)
-            | buffer[0];
+    const uint8_t *p = load_block(r, 1, 2);
+    return p ? ((uint16_t)p[1] << 8) | p[0] : 0;
+}
+
+static uint32_t load_long(bcreader *r)
+{
+    const uint8_t *p = load_block(r, 1, 4);
+    return p ? decode_long(p) : 0;
+}
+
+/* load a count of elements taking at least 'size' bytes each */
+static int load_count(bcreader *r, size_t size)
+{
+    uint32_t count = load_long(r);
+    if (r->msg == NULL && count > (size_t)(r->end - r->p) / size) {
+        r->msg = "truncated bytecode.";
+        r->p = r->end;
     }
-    return 0;
+    return r->msg == NULL ? (int)count : 0;
 }
 
-static int load_head(void *fp)
+static int load_head(bcreader *r)
 {
-    int res;
-    uint8_t buffer[8] = { 0 };
-    be_fread(fp, buffer, sizeof(buffer));
-    res = buffer[0] == MAGIC_NUMBER1 &&
-          buffer[1] == MAGIC_NUMBER2 &&
-          buffer[2] == MAGIC_NUMBER3 &&
-          buffer[4] == vm_sizeinfo();
-    if (res) {
+    const uint8_t *buffer = load_block(r, 8, 1);
+    if (buffer != NULL &&
+        buffer[0] == MAGIC_NUMBER1 &&
+        buffer[1] == MAGIC_NUMBER2 &&
+        buffer[2] == MAGIC_NUMBER3 &&
+        buffer[4] == vm_sizeinfo()) {
         return buffer[3];
-    } else {
-        return 0;
     }
+    return 0;
 }
 
 bbool be_bytecode_check(const char *path)
@@ -382,72 +452,70 @@ bbool be_bytecode_check(const char *path)
     return bfalse;
 }
 
-static bint load_int(void *fp)
+static bint load_int(bcreader *r)
 {
 #if USE_64BIT_INT
     bint i;
-    i = load_long(fp);
-    i |= (bint)load_long(fp) << 32;
+    i = load_long(r);
+    i |= (bint)load_long(r) << 32;
     return i;
 #else
-    return load_long(fp);
+    return load_long(r);
 #endif
 }
 
-static breal load_real(void *fp)
+static breal load_real(bcreader *r)
 {
 #if BE_USE_SINGLE_FLOAT
     union { breal r; uint32_t i; } u;
-    u.i = load_long(fp);
+    u.i = load_long(r);
     return u.r;
 #else
     union {
         breal r;
         uint64_t i;
     } u;
-    u.i = load_long(fp);
-    u.i |= (uint64_t)load_long(fp) << 32;
+    u.i = load_long(r);
+    u.i |= (uint64_t)load_long(r) << 32;
     return u.r;
 #endif
 }
 
-static bstring* load_string(bvm *vm, void *fp)
+static bstring* load_string(bvm *vm, bcreader *r)
 {
-    uint16_t len = load_word(fp);
+    uint16_t len = load_word(r);
     if (len > 0) {
-        bstring *str;
-        char *buf = be_malloc(vm, len);
-        be_fread(fp, buf, len);
-        str = be_newstrn(vm, buf, len);
-        be_free(vm, buf, len);
-        return str;
+        const uint8_t *data = load_block(r, len, 1);
+        if (data != NULL) {
+            return be_newstrn(vm, (const char *)data, len);
+        }
     }
     return str_literal(vm, "");
 }
 
-static bstring* cache_string(bvm *vm, void *fp)
+static bstring* cache_string(bvm *vm, bcreader *r)
 {
-    bstring *str = load_string(vm, fp);
+    bstring *str = load_string(vm, r);
     var_setstr(vm->top, str);
     be_incrtop(vm);
     return str;
 }
 
-static void load_class(bvm *vm, void *fp, bvalue *v, int version)
+static void load_class(bvm *vm, bcreader *r, bvalue *v)
 {
     int nvar, count;
     bclass *c = be_newclass(vm, NULL, NULL);
     var_setclass(v, c);
-    c->name = load_string(vm, fp);
-    nvar = load_long(fp);
-    count = load_long(fp);
+    c->name = load_string(vm, r);
+    nvar = load_count(r, 2);
+    count = load_count(r, 2);
     while (count--) { /* load method table */
         bvalue *value;
-        bstring *name = cache_string(vm, fp);
+        bstring *name = cache_string(vm, r);
         value = vm->top;
         var_setproto(value, NULL);
         be_incrtop(vm);
-        if (load_proto(vm, fp, (bproto**)&var_toobj(value), -3, version)) {
+        if (load_proto(vm, r, (bproto**)&var_toobj(value), -3)) {
             /* actual method */
             bproto *proto = (bproto*)var_toobj(value);
             bbool is_method = proto->varg & BE_VA_METHOD;
@@ -466,134 +534,178 @@ static void load_class(bvm *vm, void *fp, bvalue *v, int version)
         be_stackpop(vm, 2); /* pop the cached string and proto */
     }
     for (count = 0; count < nvar; ++count) { /* load member-variable table */
-        bstring *name = cache_string(vm, fp);
+        bstring *name = cache_string(vm, r);
         be_class_member_bind(vm, c, name, btrue);
         be_stackpop(vm, 1); /* pop the cached string */
     }
 }
 
-static void load_value(bvm *vm, void *fp, bvalue *v, int version)
+static void load_value(bvm *vm, bcreader *r, bvalue *v)
 {
-    switch (load_byte(fp)) {
-    case BE_INT: var_setint(v, load_int(fp)); break;
-    case BE_REAL: var_setreal(v, load_real(fp)); break;
-    case BE_STRING: var_setstr(v, load_string(vm, fp)); break;
-    case BE_CLASS: load_class(vm, fp, v, version); break;
+    switch (load_byte(r)) {
+    case BE_INT: var_setint(v, load_int(r)); break;
+    case BE_REAL: var_setreal(v, load_real(r)); break;
+    case BE_STRING: var_setstr(v, load_string(vm, r)); break;
+    case BE_CLASS: load_class(vm, r, v); break;
     default: break;
     }
 }
 
-static void load_bytecode(bvm *vm, void *fp, bproto *proto, int info)
+/* fix global variable index, from the global list of the file to the VM */
+static binstruction fix_global(bvm *vm, blist *list, int bcnt, binstruction ins)
 {
-    int size = (int)load_long(fp);
-    if (size) {
+    binstruction op = IGET_OP(ins);
+    if (op == OP_GETGBL || op == OP_SETGBL) {
+        int idx = IGET_Bx(ins);
+        if (idx >= bcnt && idx - bcnt < be_list_count(list)) { /* does not fix builtin index */
+            bvalue *name = be_list_at(list, idx - bcnt);
+            idx = be_global_find(vm, var_tostr(name));
+            ins = (ins & ~IBx_MASK) | ISET_Bx(idx);
+        }
+    }
+    return ins;
+}
+
+static bbool is_little_endian(void)
+{
+    const uint16_t x = 1;
+    return *(const uint8_t *)&x == 1;
+}
+
+/* execute the instructions in place in the buffer if possible */
+static bbool load_bytecode_inplace(bvm *vm, bcreader *r, bproto *proto,
+    const uint8_t *data, int size, blist *list)
+{
+    int bcnt = be_builtin_count(vm);
+    binstruction *code = (binstruction *)data, *ins, *end;
+    if (r->mode == LOAD_COPY || !is_little_endian()
+            || ((size_t)data & (sizeof(binstruction) - 1)) != 0) {
+        return bfalse;
+    }
+    for (ins = code, end = code + size; ins < end; ++ins) {
+        binstruction fixed = fix_global(vm, list, bcnt, *ins);
+        if (fixed != *ins) {
+            if (r->mode != LOAD_MAPPED) {
+                return bfalse; /* read-only buffer, copy the instructions */
+            }
+            *ins = fixed;
+        }
+    }
+    proto->code = code;
+    proto->codesize = size;
+    proto->varg |= BE_VA_SHARED_CODE;
+    r->inplace += sizeof(binstruction) * size;
+    return btrue;
+}
+
+static void load_bytecode(bvm *vm, bcreader *r, bproto *proto, int info)
+{
+    int size = (int)load_long(r);
+    const uint8_t *data;
+    if (r->version >= 5) { /* skip alignment padding */
+        load_block(r, load_byte(r), 1);
+    }
+    data = load_block(r, size, sizeof(binstruction));
+    if (size && data) {
         binstruction *code, *end;
         int bcnt = be_builtin_count(vm);
         blist *list = var_toobj(be_indexof(vm, info));
         be_assert(be_islist(vm, info));
+        if (load_bytecode_inplace(vm, r, proto, data, size, list)) {
+            return;
+        }
         proto->code = be_malloc(vm, sizeof(binstruction) * size);
         proto->codesize = size;
         code = proto->code;
         for (end = code + size; code < end; ++code) {
-            binstruction ins = (binstruction)load_long(fp);
-            binstruction op = IGET_OP(ins);
-            /* fix global variable index */
-            if (op == OP_GETGBL || op == OP_SETGBL) {
-                int idx = IGET_Bx(ins);
-                if (idx >= bcnt) { /* does not fix builtin index */
-                    bvalue *name = be_list_at(list, idx - bcnt);
-                    idx = be_global_find(vm, var_tostr(name));
-                    ins = (ins & ~IBx_MASK) | ISET_Bx(idx);
-                }
-            }
-            *code = ins;
+            *code = fix_global(vm, list, bcnt, (binstruction)decode_long(data));
+            data += sizeof(binstruction);
         }
     }
 }
 
-static void load_constant(bvm *vm, void *fp, bproto *proto, int version)
+static void load_constant(bvm *vm, bcreader *r, bproto *proto)
 {
-    int size = (int)load_long(fp); /* nconst */
+    int size = load_count(r, 1); /* nconst */
     if (size) {
         bvalue *end, *v = be_malloc(vm, sizeof(bvalue) * size);
         memset(v, 0, sizeof(bvalue) * size);
         proto->ktab = v;
         proto->nconst = size;
         for (end = v + size; v < end; ++v) {
-            load_value(vm, fp, v, version);
+            load_value(vm, r, v);
         }
     }
 }
 
-static void load_proto_table(bvm *vm, void *fp, bproto *proto, int info, int version)
+static void load_proto_table(bvm *vm, bcreader *r, bproto *proto, int info)
 {
-    int size = (int)load_long(fp); /* proto count */
+    int size = load_count(r, 2); /* proto count */
     if (size) {
         bproto **p = be_malloc(vm, sizeof(bproto *) * size);
         memset(p, 0, sizeof(bproto *) * size);
         proto->ptab = p;
         proto->nproto = size;
         while (size--) {
-            load_proto(vm, fp, p++, info, version);
+            load_proto(vm, r, p++, info);
         }
     }
 }
 
-static void load_upvals(bvm *vm, void *fp, bproto *proto)
+static void load_upvals(bvm *vm, bcreader *r, bproto *proto)
 {
-    int size = (int)load_byte(fp);
-    if (size) {
+    int size = (int)load_byte(r);
+    const uint8_t *data = load_block(r, size, 2);
+    if (size && data) {
         bupvaldesc *uv, *end;
         proto->upvals = be_malloc(vm, sizeof(bupvaldesc) * size);
         proto->nupvals = (bbyte)size;
         uv = proto->upvals;
         for (end = uv + size; uv < end; ++uv) {
-            uv->instack = load_byte(fp);
-            uv->idx = load_byte(fp);
+            uv->instack = *data++;
+            uv->idx = *data++;
         }
     }
 }
 
-static bbool load_proto(bvm *vm, void *fp, bproto **proto, int info, int version)
+static bbool load_proto(bvm *vm, bcreader *r, bproto **proto, int info)
 {
     /* first load the name */
     /* if empty, it's a static member so don't allocate an actual proto */
-    bstring *name = load_string(vm, fp);
+    bstring *name = load_string(vm, r);
     if (str_len(name)) {
         *proto = be_newproto(vm);
         (*proto)->name = name;
 #if BE_DEBUG_SOURCE_FILE
-        (*proto)->source = load_string(vm, fp);
+        (*proto)->source = load_string(vm, r);
 #else
-        load_string(vm, fp);    /* discard name */
+        load_string(vm, r);    /* discard name */
 #endif
-        (*proto)->argc = load_byte(fp);
-        (*proto)->nstack = load_byte(fp);
-        if (version > 1) {
-            (*proto)->varg = load_byte(fp);
-            load_byte(fp); /* discard reserved byte */
-        }
-        load_bytecode(vm, fp, *proto, info);
-        load_constant(vm, fp, *proto, version);
-        load_proto_table(vm, fp, *proto, info, version);
-        load_upvals(vm, fp, *proto);
+        (*proto)->argc = load_byte(r);
+        (*proto)->nstack = load_byte(r);
+        (*proto)->varg = load_byte(r) & ~BE_VA_SHARED_CODE;
+        load_byte(r); /* discard reserved byte */
+        load_bytecode(vm, r, *proto, info);
+        load_constant(vm, r, *proto);
+        load_proto_table(vm, r, *proto, info);
+        load_upvals(vm, r, *proto);
         return btrue;
     }
     return bfalse;  /* no proto read */
 }
 
-void load_global_info(bvm *vm, void *fp)
+static void load_global_info(bvm *vm, bcreader *r)
 {
     int i;
-    int bcnt = (int)load_long(fp); /* builtin count */
-    int gcnt = (int)load_long(fp); /* global count */
-    if (bcnt > be_builtin_count(vm)) {
-        bytecode_error(vm, be_pushfstring(vm,
-            "inconsistent number of builtin objects."));
+    int bcnt = (int)load_long(r); /* builtin count */
+    int gcnt = load_count(r, 2); /* global count */
+    if (bcnt > be_builtin_count(vm) && r->msg == NULL) {
+        r->msg = "inconsistent number of builtin objects.";
+        gcnt = 0;
     }
     be_newlist(vm);
     for (i = 0; i < gcnt; ++i) {
-        bstring *name = cache_string(vm, fp);
+        bstring *name = cache_string(vm, r);
         be_global_new(vm, name);
         be_data_push(vm, -2); /* push the variable name to list */
         be_stackpop(vm, 1); /* pop the cached string */
@@ -601,27 +713,152 @@ void load_global_info(bvm *vm, void *fp)
     be_global_release_space(vm);
 }
 
+/* load the main closure, returns NULL and sets the error message on failure */
+static bclosure* load_closure(bvm *vm, bcreader *r)
+{
+    bclosure *cl;
+    r->version = load_head(r);
+    if (r->version < BYTECODE_VERSION_MIN || r->version > BYTECODE_VERSION_MAX) {
+        r->msg = "invalid bytecode version.";
+        return NULL;
+    }
+    cl = be_newclosure(vm, 0);
+    var_setclosure(vm->top, cl);
+    be_stackpush(vm);
+    load_global_info(vm, r);
+    load_proto(vm, r, &cl->proto, -1);
+    be_stackpop(vm, 2); /* pop the closure and list */
+    return r->msg == NULL ? cl : NULL;
+}
+
+/* load bytecode from memory, if 'shared' the buffer must remain valid
+ * and unchanged for the lifetime of the VM, instructions are executed in place */
+bclosure* be_bytecode_load_from_buffer(bvm *vm, const void *buffer, size_t size, bbool shared)
+{
+    bcreader r;
+    bclosure *cl;
+    reader_init(&r, buffer, size, shared ? LOAD_SHARED : LOAD_COPY);
+    cl = load_closure(vm, &r);
+    if (cl == NULL) {
+        bytecode_error(vm, r.msg);
+    }
+    return cl;
+}
+
+struct fsload {
+    void *buffer;
+    size_t size;
+    bclosure *cl;
+    const char *msg;
+};
+
+static void fsload_closure(bvm *vm, void *data)
+{
+    struct fsload *l = data;
+    bcreader r;
+    reader_init(&r, l->buffer, l->size, LOAD_COPY);
+    l->cl = load_closure(vm, &r);
+    l->msg = r.msg;
+}
+
+/* load bytecode from the current position of the file, the file is closed */
 bclosure* be_bytecode_load_from_fs(bvm *vm, void *fp)
 {
-    int version = load_head(fp);
-    if (version == BYTECODE_VERSION) {
-        bclosure *cl = be_newclosure(vm, 0);
-        var_setclosure(vm->top, cl);
-        be_stackpush(vm);
-        load_global_info(vm, fp);
-        load_proto(vm, fp, &cl->proto, -1, version);
-        be_stackpop(vm, 2); /* pop the closure and list */
+    struct fsload l;
+    long pos = be_ftell(fp);
+    size_t size = be_fsize(fp);
+    uint8_t *buffer;
+    int res;
+    if (pos > 0) { /* the bytecode may start inside the file */
+        size = (size_t)pos < size ? size - (size_t)pos : 0;
+    }
+    if (size == 0) {
         be_fclose(fp);
-        return cl;
+        bytecode_error(vm, "truncated bytecode.");
+    }
+    buffer = be_malloc(vm, size);
+    l.buffer = buffer;
+    l.size = be_fread(fp, buffer, size); /* a short read is reported as truncated */
+    l.cl = NULL;
+    l.msg = NULL;
+    be_fclose(fp);
+    /* the buffer is freed before any error is raised again */
+    res = be_execprotected(vm, fsload_closure, &l);
+    be_free(vm, buffer, size);
+    if (res) {
+        be_throw(vm, res);
     }
-    bytecode_error(vm, be_pushfstring(vm,
-        "invalid bytecode version."));
-    return NULL;
+    if (l.cl == NULL) {
+        bytecode_error(vm, l.msg);
+    }
+    return l.cl;
+}
+
+#if BE_USE_BYTECODE_MMAP
+/* bytecode file mapped in memory, kept while its instructions may run */
+struct bmapping {
+    void *data;
+    size_t size;
+    struct bmapping *next;
+};
+
+/* unmap the bytecode files of the VM, their protos must be freed */
+void be_bytecode_unmap_all(bvm *vm)
+{
+    struct bmapping *m = vm->mappings;
+    while (m != NULL) {
+        struct bmapping *next = m->next;
+        be_funmap(m->data, m->size);
+        be_os_free(m);
+        m = next;
+    }
+    vm->mappings = NULL;
 }
 
+/* load a mapped bytecode file, the mapping is registered in the VM first so
+ * that it is released with the VM if loading raises an error */
+static bclosure* load_mapped(bvm *vm, void *data, size_t size)
+{
+    bcreader r;
+    bclosure *cl;
+    struct bmapping *m = be_os_malloc(sizeof(struct bmapping));
+    if (m == NULL) {
+        be_funmap(data, size);
+        return NULL;
+    }
+    m->data = data;
+    m->size = size;
+    m->next = vm->mappings;
+    vm->mappings = m;
+    reader_init(&r, data, size, LOAD_MAPPED);
+    cl = load_closure(vm, &r);
+    if (cl == NULL || r.inplace == 0) {
+        vm->mappings = m->next; /* no instruction is executed in place */
+        be_funmap(data, size);
+        be_os_free(m);
+    }
+    if (cl == NULL) {
+        bytecode_error(vm, r.msg);
+    }
+    return cl;
+}
+#endif
+
 bclosure* be_bytecode_load(bvm *vm, const char *filename)
 {
-    void *fp = be_fopen(filename, "rb");
+    void *fp;
+#if BE_USE_BYTECODE_MMAP
+    size_t size;
+    void *data = be_fmap(filename, &size);
+    if (data != NULL) {
+        bclosure *cl = load_mapped(vm, data, size);
+        if (cl != NULL) {
+            return cl;
+        }
+        /* out of memory for the mapping record, read the file instead */
+    }
+#endif
+    fp = be_fopen(filename, "rb");
     if (fp == NULL) {
         bytecode_error(vm, be_pushfstring(vm,
             "can not open file '%s'.", filename));
@@ -14,6 +14,8 @@ void be_bytecode_save(bvm *vm, const char *filename, bproto *proto);
 void be_bytecode_save_to_fs(bvm *vm, void *fp, bproto *proto);
 bclosure* be_bytecode_load(bvm *vm, const char *filename);
 bclosure* be_bytecode_load_from_fs(bvm *vm, void *fp);
+bclosure* be_bytecode_load_from_buffer(bvm *vm, const void *buffer, size_t size, bbool shared);
 bbool be_bytecode_check(const char *path);
+void be_bytecode_unmap_all(bvm *vm);
 
 #endif
@@ -1591,12 +1591,23 @@ static int m_fromhex(bvm *vm)
  * Note: the address is guaranteed not to move unless you
  * resize the buffer
  * 
- * `_buffer() -> comptr`
+ * An optional byte offset gives the address inside the buffer,
+ * e.g. to map a window over a part of it with `bytes(comptr, size)`
+ * 
+ * `_buffer([offset:int]) -> comptr`
  */
 static int m_buffer(bvm *vm)
 {
+    int argc = be_top(vm);
     buf_impl attr = m_read_attributes(vm, 1);
-    be_pushcomptr(vm, attr.bufptr);
+    int32_t offset = 0;
+    if (argc >= 2 && be_isint(vm, 2)) {
+        offset = be_toint(vm, 2);
+        if (offset < 0 || offset > attr.len) {
+            be_raise(vm, "index_error", "bytes index out of range");
+        }
+    }
+    be_pushcomptr(vm, attr.bufptr ? attr.bufptr + offset : NULL);
     be_return(vm);
 }
 
@@ -0,0 +1,434 @@
+/********************************************************************
+** Berry Animation DSL native scanner for the emulator
+**
+** Tokenizes DSL source in a single pass into a compact stream of
+** records, used by the pull lexer in `dsl/lexer.be` instead of
+** scanning character by character in Berry.
+**
+** Each record is 5 little-endian int32: type, start, length, line, col
+** with the same values as the Berry scanner in `dsl/scanner.be`.
+** Records are split in `bytes` chunks of 1024 records, to stay below
+** the maximum size of `bytes` objects.
+** Words are recorded as IDENTIFIER, keywords and color names are
+** resolved by the lexer when the token is materialized.
+**
+** To use: `import dsl_scanner_ntv`
+********************************************************************/
+#include "berry.h"
+#include "be_object.h"
+#include "be_mem.h"
+#include <string.h>
+#include <stdio.h>
+
+#define SCAN_RECORD_SIZE    20
+#define SCAN_CHUNK_RECORDS  1024
+#define SCAN_CHUNK_SIZE     (SCAN_RECORD_SIZE * SCAN_CHUNK_RECORDS)
+#define SCAN_ERROR_SIZE     160
+
+/* token types, see `dsl/token.be` */
+enum {
+    TK_IDENTIFIER = 1, TK_NUMBER = 2, TK_STRING = 3, TK_COLOR = 4, TK_TIME = 5,
+    TK_PERCENTAGE = 6, TK_MULTIPLIER = 7, TK_ASSIGN = 8, TK_PLUS = 9, TK_MINUS = 10,
+    TK_MULTIPLY = 11, TK_DIVIDE = 12, TK_MODULO = 13, TK_POWER = 14, TK_EQUAL = 15,
+    TK_NOT_EQUAL = 16, TK_LESS_THAN = 17, TK_LESS_EQUAL = 18, TK_GREATER_THAN = 19,
+    TK_GREATER_EQUAL = 20, TK_LOGICAL_AND = 21, TK_LOGICAL_OR = 22, TK_LOGICAL_NOT = 23,
+    TK_LEFT_PAREN = 24, TK_RIGHT_PAREN = 25, TK_LEFT_BRACE = 26, TK_RIGHT_BRACE = 27,
+    TK_LEFT_BRACKET = 28, TK_RIGHT_BRACKET = 29, TK_COMMA = 30, TK_SEMICOLON = 31,
+    TK_COLON = 32, TK_DOT = 33, TK_ARROW = 34, TK_NEWLINE = 35, TK_VARIABLE_REF = 36,
+    TK_COMMENT = 37
+};
+
+/* records, owned by a comobj so that they are freed if an error is raised */
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t alloc;
+} scan_out_t;
+
+typedef struct {
+    bvm *vm;
+    const char *src;
+    size_t size;
+    size_t pos;
+    int32_t line;
+    int32_t col;
+    scan_out_t *out;
+    char error[SCAN_ERROR_SIZE];
+    size_t error_len;       /* 0 if no error */
+} scanner_t;
+
+#define is_alpha(c)     (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z'))
+#define is_digit(c)     ((c) >= '0' && (c) <= '9')
+#define is_alnum(c)     (is_alpha(c) || is_digit(c))
+#define is_hex(c)       (is_digit(c) || ((c) >= 'a' && (c) <= 'f') || ((c) >= 'A' && (c) <= 'F'))
+
+/* char at offset n from current position, or -1 at end */
+static int peek(scanner_t *s, size_t n)
+{
+    return s->pos + n < s->size ? (unsigned char)s->src[s->pos + n] : -1;
+}
+
+static int advance(scanner_t *s)
+{
+    if (s->pos >= s->size) {
+        return -1;
+    }
+    s->col++;
+    return (unsigned char)s->src[s->pos++];
+}
+
+static void put_int32(uint8_t *p, int32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/* same position tracking as `create_token()` in Berry */
+static void emit(scanner_t *s, int type, size_t start, size_t length)
+{
+    scan_out_t *out = s->out;
+    if (out->len + SCAN_RECORD_SIZE > out->alloc) {
+        size_t alloc = out->alloc ? out->alloc * 2 : SCAN_RECORD_SIZE * 64;
+        out->buf = be_realloc(s->vm, out->buf, out->alloc, alloc);
+        out->alloc = alloc;
+    }
+    uint8_t *p = out->buf + out->len;
+    put_int32(p, type);
+    put_int32(p + 4, (int32_t)start);
+    put_int32(p + 8, (int32_t)length);
+    put_int32(p + 12, s->line);
+    put_int32(p + 16, s->col - (int32_t)length);
+    out->len += SCAN_RECORD_SIZE;
+}
+
+/* record error message with current position, always returns 0 */
+static int scan_error(scanner_t *s, const char *msg, const char *arg, size_t arg_len, const char *suffix)
+{
+    int n = snprintf(s->error, SCAN_ERROR_SIZE, "Line %d:%d: %s", (int)s->line, (int)s->col, msg);
+    size_t len = n < SCAN_ERROR_SIZE ? (size_t)n : SCAN_ERROR_SIZE - 1;
+    if (arg != NULL) {
+        if (arg_len > SCAN_ERROR_SIZE - 1 - len) {
+            arg_len = SCAN_ERROR_SIZE - 1 - len;
+        }
+        memcpy(s->error + len, arg, arg_len);
+        len += arg_len;
+    }
+    if (suffix != NULL) {
+        size_t suffix_len = strlen(suffix);
+        if (suffix_len > SCAN_ERROR_SIZE - 1 - len) {
+            suffix_len = SCAN_ERROR_SIZE - 1 - len;
+        }
+        memcpy(s->error + len, suffix, suffix_len);
+        len += suffix_len;
+    }
+    s->error_len = len;
+    return 0;
+}
+
+static int scan_comment(scanner_t *s, size_t start)
+{
+    while (s->pos < s->size && s->src[s->pos] != '\n') {
+        advance(s);
+    }
+    emit(s, TK_COMMENT, start, s->pos - start);
+    return 1;
+}
+
+static int scan_hex_color_0x(scanner_t *s, size_t start)
+{
+    advance(s);     /* 'x' */
+    int digits = 0;
+    while (is_hex(peek(s, 0))) {
+        advance(s);
+        digits++;
+    }
+    if (digits == 6 || digits == 8) {
+        emit(s, TK_COLOR, start, s->pos - start);
+        return 1;
+    }
+    return scan_error(s, "Invalid hex color format: ", s->src + start, s->pos - start,
+                      " (expected 0xRRGGBB or 0xAARRGGBB)");
+}
+
+static int scan_identifier(scanner_t *s, size_t start, int type)
+{
+    while (is_alnum(peek(s, 0)) || peek(s, 0) == '_') {
+        advance(s);
+    }
+    emit(s, type, start, s->pos - start);
+    return 1;
+}
+
+static int scan_number(scanner_t *s, size_t start)
+{
+    while (is_digit(peek(s, 0))) {
+        advance(s);
+    }
+    if (peek(s, 0) == '.' && is_digit(peek(s, 1))) {
+        advance(s);
+        while (is_digit(peek(s, 0))) {
+            advance(s);
+        }
+    }
+    int c = peek(s, 0);
+    int type = TK_NUMBER;
+    if (c == 'm' || c == 's' || c == 'h') {
+        advance(s);
+        if (c == 'm' && peek(s, 0) == 's') {
+            advance(s);
+        }
+        type = TK_TIME;
+    } else if (c == '%') {
+        advance(s);
+        type = TK_PERCENTAGE;
+    } else if (c == 'x') {
+        advance(s);
+        type = TK_MULTIPLIER;
+    }
+    emit(s, type, start, s->pos - start);
+    return 1;
+}
+
+static int scan_string(scanner_t *s, size_t start, int quote)
+{
+    while (s->pos < s->size && peek(s, 0) != quote) {
+        int c = advance(s);
+        if (c == '\\') {
+            advance(s);     /* escaped char, no line tracking */
+        } else if (c == '\n') {
+            s->line++;
+            s->col = 1;
+        }
+    }
+    if (s->pos >= s->size) {
+        return scan_error(s, "Unterminated string literal", NULL, 0, NULL);
+    }
+    advance(s);     /* closing quote */
+    emit(s, TK_STRING, start, s->pos - start);
+    return 1;
+}
+
+static int scan_triple_quoted_string(scanner_t *s, size_t start, int quote)
+{
+    advance(s);
+    advance(s);
+    while (s->pos < s->size) {
+        if (peek(s, 0) == quote && peek(s, 1) == quote && peek(s, 2) == quote) {
+            advance(s);
+            advance(s);
+            advance(s);
+            break;
+        }
+        if (advance(s) == '\n') {
+            s->line++;
+            s->col = 1;
+        }
+    }
+    /* same check as Berry, the source may end with the closing quotes */
+    if (s->pos >= s->size && !(s->src[s->pos - 1] == quote && s->src[s->pos - 2] == quote && s->src[s->pos - 3] == quote)) {
+        return scan_error(s, "Unterminated triple-quoted string literal", NULL, 0, NULL);
+    }
+    emit(s, TK_STRING, start, s->pos - start);
+    return 1;
+}
+
+static int scan_variable_reference(scanner_t *s, size_t start)
+{
+    int c = peek(s, 0);
+    if (!(is_alpha(c) || c == '_')) {
+        return scan_error(s, "Invalid variable reference: $ must be followed by identifier", NULL, 0, NULL);
+    }
+    return scan_identifier(s, start, TK_VARIABLE_REF);
+}
+
+/* consume the next char if it matches */
+static int match(scanner_t *s, int expected)
+{
+    if (peek(s, 0) != expected) {
+        return 0;
+    }
+    advance(s);
+    return 1;
+}
+
+static int scan_operator(scanner_t *s, size_t start, int c)
+{
+    int type;
+    switch (c) {
+    case '=': type = match(s, '=') ? TK_EQUAL : TK_ASSIGN; break;
+    case '!': type = match(s, '=') ? TK_NOT_EQUAL : TK_LOGICAL_NOT; break;
+    case '<':
+        if (match(s, '=')) {
+            type = TK_LESS_EQUAL;
+        } else if (match(s, '<')) {
+            return scan_error(s, "Left shift operator '<<' not supported in DSL", NULL, 0, NULL);
+        } else {
+            type = TK_LESS_THAN;
+        }
+        break;
+    case '>':
+        if (match(s, '=')) {
+            type = TK_GREATER_EQUAL;
+        } else if (match(s, '>')) {
+            return scan_error(s, "Right shift operator '>>' not supported in DSL", NULL, 0, NULL);
+        } else {
+            type = TK_GREATER_THAN;
+        }
+        break;
+    case '&':
+        if (!match(s, '&')) {
+            return scan_error(s, "Single '&' not supported in DSL", NULL, 0, NULL);
+        }
+        type = TK_LOGICAL_AND;
+        break;
+    case '|':
+        if (!match(s, '|')) {
+            return scan_error(s, "Single '|' not supported in DSL", NULL, 0, NULL);
+        }
+        type = TK_LOGICAL_OR;
+        break;
+    case '-': type = match(s, '>') ? TK_ARROW : TK_MINUS; break;
+    case '+': type = TK_PLUS; break;
+    case '*': type = TK_MULTIPLY; break;
+    case '/': type = TK_DIVIDE; break;
+    case '%': type = TK_MODULO; break;
+    case '^': type = TK_POWER; break;
+    case '(': type = TK_LEFT_PAREN; break;
+    case ')': type = TK_RIGHT_PAREN; break;
+    case '{': type = TK_LEFT_BRACE; break;
+    case '}': type = TK_RIGHT_BRACE; break;
+    case '[': type = TK_LEFT_BRACKET; break;
+    case ']': type = TK_RIGHT_BRACKET; break;
+    case ',': type = TK_COMMA; break;
+    case ';': type = TK_SEMICOLON; break;
+    case ':': type = TK_COLON; break;
+    case '.': type = TK_DOT; break;
+    default:
+        return scan_error(s, "Unexpected character: '", s->src + start, 1, "'");
+    }
+    emit(s, type, start, s->pos - start);
+    return 1;
+}
+
+/* scan the next token, returns 0 on error */
+static int scan_token(scanner_t *s)
+{
+    size_t start = s->pos;
+    int c = advance(s);
+    switch (c) {
+    case ' ': case '\t': case '\r':
+        return 1;
+    case '\n':
+        emit(s, TK_NEWLINE, start, 1);
+        s->line++;
+        s->col = 1;
+        return 1;
+    case '#':
+        return scan_comment(s, start);
+    case '$':
+        return scan_variable_reference(s, start);
+    case '"': case '\'':
+        if (peek(s, 0) == c && peek(s, 1) == c) {
+            return scan_triple_quoted_string(s, start, c);
+        }
+        return scan_string(s, start, c);
+    default:
+        break;
+    }
+    if (c == '0' && peek(s, 0) == 'x') {
+        return scan_hex_color_0x(s, start);
+    } else if (is_alpha(c) || c == '_') {
+        return scan_identifier(s, start, TK_IDENTIFIER);
+    } else if (is_digit(c)) {
+        return scan_number(s, start);
+    }
+    return scan_operator(s, start, c);
+}
+
+/* comobj destructor */
+static int scan_out_destroy(bvm *vm)
+{
+    scan_out_t *out = be_tocomptr(vm, 1);
+    if (out) {
+        if (out->buf != NULL) {
+            be_free(vm, out->buf, out->alloc);
+        }
+        be_free(vm, out, sizeof(scan_out_t));
+    }
+    be_return_nil(vm);
+}
+
+// Berry: `dsl_scanner_ntv.scan(source:string, records:list) -> nil or string`
+// Fills `records` with chunks of token records of `source`, up to the first
+// lexical error. Returns the error message or `nil` if the whole source was scanned.
+static int m_scan(bvm *vm)
+{
+    if (be_top(vm) >= 2 && be_isstring(vm, 1) && be_isinstance(vm, 2)) {
+        scanner_t s;
+        scan_out_t *out = be_malloc(vm, sizeof(scan_out_t));
+        memset(out, 0, sizeof(scan_out_t));
+        be_newcomobj(vm, out, scan_out_destroy);   /* kept on the stack until return */
+        memset(&s, 0, sizeof(s));
+        s.vm = vm;
+        s.out = out;
+        s.src = be_tostring(vm, 1);
+        s.size = be_strlen(vm, 1);
+        s.line = 1;
+        s.col = 1;
+        while (s.pos < s.size) {
+            if (!scan_token(&s)) {
+                break;
+            }
+        }
+        /* split records in `bytes` chunks, each below the max size of `bytes` */
+        be_getmember(vm, 2, "clear");
+        be_pushvalue(vm, 2);
+        be_call(vm, 1);
+        be_pop(vm, 2);
+        for (size_t offset = 0; offset < out->len; offset += SCAN_CHUNK_SIZE) {
+            size_t len = out->len - offset;
+            if (len > SCAN_CHUNK_SIZE) {
+                len = SCAN_CHUNK_SIZE;
+            }
+            be_getmember(vm, 2, "push");
+            be_pushvalue(vm, 2);
+            be_pushbytes(vm, out->buf + offset, len);
+            be_call(vm, 2);
+            be_pop(vm, 3);
+        }
+        /* release the records now, the comobj is collected later */
+        if (out->buf != NULL) {
+            be_free(vm, out->buf, out->alloc);
+            out->buf = NULL;
+            out->alloc = 0;
+        }
+        if (s.error_len > 0) {
+            be_pushnstring(vm, s.error, s.error_len);
+            be_return(vm);
+        }
+        be_return_nil(vm);
+    }
+    be_raise(vm, "type_error", "scan requires a string and a list");
+    be_return_nil(vm);
+}
+
+#if !BE_USE_PRECOMPILED_OBJECT
+be_native_module_attr_table(dsl_scanner_ntv) {
+    be_native_module_function("scan", m_scan),
+    be_native_module_int("RECORD_SIZE", SCAN_RECORD_SIZE),
+    be_native_module_int("CHUNK_RECORDS", SCAN_CHUNK_RECORDS),
+};
+
+be_define_native_module(dsl_scanner_ntv, NULL);
+#else
+/* @const_object_info_begin
+module dsl_scanner_ntv (scope: global) {
+    scan, func(m_scan)
+    RECORD_SIZE, int(SCAN_RECORD_SIZE)
+    CHUNK_RECORDS, int(SCAN_CHUNK_RECORDS)
+}
+@const_object_info_end */
+#include "../generate/be_fixed_dsl_scanner_ntv.h"
+#endif
@@ -269,6 +269,37 @@ static int load_bytecode(bvm *vm, const char *name)
     return res;
 }
 
+struct bytecodebuf {
+    const void *buffer;
+    size_t length;
+    bbool shared;
+};
+
+static void bytecode_buffer_loader(bvm *vm, void *data)
+{
+    struct bytecodebuf *b = data;
+    bclosure *cl = be_bytecode_load_from_buffer(vm, b->buffer, b->length, b->shared);
+    var_setclosure(vm->top, cl);
+    be_incrtop(vm);
+}
+
+/* load bytecode from a buffer, if 'shared' the buffer must remain valid
+ * and unchanged for the lifetime of the VM */
+BERRY_API int be_loadbytecode(bvm *vm, const void *buffer, size_t length, bbool shared)
+{
+    int res;
+    struct vmstate state;
+    struct bytecodebuf b;
+    b.buffer = buffer;
+    b.length = length;
+    b.shared = shared;
+    vm_state_save(vm, &state);
+    res = be_execprotected(vm, bytecode_buffer_loader, &b);
+    if (res) { /* restore call stack */
+        vm_state_restore(vm, &state, res);
+    }
+    return res;
+}
 #else
 #define load_bytecode(vm, name) BE_SYNTAX_ERROR
 #endif /* BE_USE_BYTECODE_LOADER */
@@ -18,6 +18,7 @@
 #include "be_module.h"
 #include "be_exec.h"
 #include "be_debug.h"
+#include "be_profiler.h"
 
 #define GC_PAUSE    (1 << 0) /* GC will not be executed automatically */
 #define GC_HALT     (1 << 1) /* GC completely stopped */
@@ -83,7 +84,11 @@ void be_gc_setpause(bvm *vm, int pause)
 
 bgcobject* be_newgcobj(bvm *vm, int type, size_t size)
 {
-    bgcobject *obj = be_malloc(vm, size);
+    bgcobject *obj;
+#if BE_USE_PROFILER
+    vm->profile_alloc_type = type;
+#endif
+    obj = be_malloc(vm, size);
     be_gc_auto(vm);
     var_settype(obj, (bbyte)type); /* mark the object type */
     obj->marked = GC_WHITE; /* default gc object type is white */
@@ -98,6 +103,9 @@ bgcobject* be_gc_newstr(bvm *vm, size_t size, int islong)
     if (islong) { /* creating long strings is similar to ordinary GC objects */
         return be_newgcobj(vm, BE_STRING, size);
     }
+#if BE_USE_PROFILER
+    vm->profile_alloc_type = BE_STRING;
+#endif
     obj = be_malloc(vm, size);
     be_gc_auto(vm);
     var_settype(obj, BE_STRING); /* mark the object type to BE_STRING */
@@ -319,6 +327,11 @@ static void free_proto(bvm *vm, bgcobject *obj)
 {
     bproto *proto = cast_proto(obj);
     gc_try (proto != NULL) {
+#if BE_USE_PROFILER
+        if (vm->profiler) {
+            be_profiler_forget(vm, proto);
+        }
+#endif
         be_free(vm, proto->upvals, proto->nupvals * sizeof(bupvaldesc));
         if (!(proto->varg & BE_VA_SHARED_KTAB)) {       /* do not free shared ktab */
                                                         /*caveat: the shared ktab is never GCed, in practice this is not a problem */
@@ -326,7 +339,9 @@ static void free_proto(bvm *vm, bgcobject *obj)
             be_free(vm, proto->ktab, proto->nconst * sizeof(bvalue));
         }
         be_free(vm, proto->ptab, proto->nproto * sizeof(bproto*));
-        be_free(vm, proto->code, proto->codesize * sizeof(binstruction));
+        if (!(proto->varg & BE_VA_SHARED_CODE)) {       /* do not free code in place in a bytecode buffer */
+            be_free(vm, proto->code, proto->codesize * sizeof(binstruction));
+        }
 #if BE_DEBUG_RUNTIME_INFO
         be_free(vm, proto->lineinfo, proto->nlineinfo * sizeof(blineinfo));
 #endif
@@ -503,6 +518,7 @@ static void destruct_object(bvm *vm, bgcobject *obj)
 static void destruct_white(bvm *vm)
 {
     bgcobject *node = vm->gc.list;
+    bvalue *v;
     /* since the destructor may allocate objects, we must first suspend the GC */
     vm->gc.status |= GC_HALT; /* mark GC is halt */
     while (node) {
@@ -511,6 +527,12 @@ static void destruct_white(bvm *vm)
         }
         node = node->next;
     }
+    /* destructors ran above the stack top: clear the instances and
+     * registers they left there, the objects are freed next and a frame
+     * raising the top would expose them to the following collection */
+    for (v = vm->top; v < vm->stacktop; ++v) {
+        var_setnil(v);
+    }
     vm->gc.status &= ~GC_HALT; /* reset GC halt flag */
 }
 
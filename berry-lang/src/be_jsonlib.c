@@ -9,6 +9,7 @@
 #include "be_mem.h"
 #include "be_lexer.h"
 #include <string.h>
+#include <stdio.h>
 #include <math.h>
 #include <ctype.h>
 
@@ -24,27 +25,65 @@
 /* Security: Maximum JSON string length to prevent memory exhaustion attacks */
 #define MAX_JSON_STRING_LEN  (1024 * 1024)  /* 1MB limit */
 
-static const char* parser_value(bvm *vm, const char *json);
-static void value_dump(bvm *vm, int *indent, int idx, int fmt);
+#define STREAM_CHUNK_SIZE   1024    /* size of reads from stream sources */
+#define WRITER_INIT_SIZE    128     /* initial size of the dump buffer */
 
-static const char* skip_space(const char *s)
-{
-    int c;
-    while (((c = *s) != '\0') && ((c == ' ')
-        || (c == '\t') || (c == '\r') || (c == '\n'))) {
-        ++s;
-    }
-    return s;
-}
+/* events passed to the json.scan() callback */
+enum {
+    JSON_START_OBJECT = 1,
+    JSON_END_OBJECT = 2,
+    JSON_START_ARRAY = 3,
+    JSON_END_ARRAY = 4,
+    JSON_KEY = 5,
+    JSON_VALUE = 6
+};
 
-static const char* match_char(const char *json, int ch)
-{
-    json = skip_space(json);
-    if (*json == ch) {
-        return skip_space(json + 1);
-    }
-    return NULL;
-}
+/* what the scanner does with the values */
+enum {
+    SCAN_SKIP,          /* validate only */
+    SCAN_BUILD,         /* push the Berry value */
+    SCAN_EVENTS         /* call the json.scan() callback */
+};
+
+/* scanner status */
+enum {
+    SCAN_ERROR = 0,
+    SCAN_OK = 1,
+    SCAN_STOP = 2       /* stopped by the json.scan() callback */
+};
+
+/* JSON input, either a string or a stream object with a 'read(size)' method
+ * such as a file. Streams are read in chunks into a window buffer, which only
+ * grows to hold the longest token. Buffers are strings anchored on the VM
+ * stack, so they are collected normally if an error is raised. */
+typedef struct {
+    bvm *vm;
+    const char *s;      /* start of the current token */
+    const char *end;    /* end of the available data, followed by '\0' */
+    char *buf;          /* window buffer of streams */
+    size_t size;
+    char *tmp;          /* buffer to decode escaped strings */
+    size_t tmpsize;
+    int stream;         /* stack index of the stream, 0 at the end of input */
+    int bufidx;         /* stack index of 'buf' */
+    int tmpidx;         /* stack index of 'tmp' */
+    int mode;
+    int callback;       /* stack index of the json.scan() callback */
+} jinput;
+
+/* JSON output, appended to a buffer anchored on the VM stack that is
+ * doubled when full */
+typedef struct {
+    bvm *vm;
+    char *buf;
+    size_t len, size;
+    int bufidx;         /* stack index of 'buf' */
+    int indent;
+    int fmt;
+} jwriter;
+
+static int scan_value(jinput *in);
+static void value_dump(jwriter *w, int idx);
 
 static int is_object(bvm *vm, const char *class, int idx)
 {
@@ -66,68 +105,6 @@ static int is_object(bvm *vm, const char *class, int idx)
     return  0;
 }
 
-/* Calculate the actual buffer size needed for JSON string parsing
- * accounting for Unicode expansion and security limits */
-static size_t json_strlen_safe(const char *json, size_t *actual_len)
-{
-    int ch;
-    const char *s = json + 1; /* skip '"' */
-    size_t char_count = 0;
-    size_t byte_count = 0;
-    
-    while ((ch = *s) != '\0' && ch != '"') {
-        char_count++;
-        if (char_count > MAX_JSON_STRING_LEN) {
-            return SIZE_MAX; /* String too long */
-        }
-        
-        ++s;
-        if (ch == '\\') {
-            ch = *s++;
-            if (ch == '\0') {
-                return SIZE_MAX; /* Malformed string */
-            }
-            
-            switch (ch) {
-            case '"': case '\\': case '/':
-            case 'b': case 'f': case 'n': case 'r': case 't':
-                byte_count += 1;
-                break;
-            case 'u':
-                /* Unicode can expand to 1-3 UTF-8 bytes
-                 * We conservatively assume 3 bytes for safety */
-                byte_count += 3;
-                /* Verify we have 4 hex digits following */
-                for (int i = 0; i < 4; i++) {
-                    if (!s[i] || !isxdigit((unsigned char)s[i])) {
-                        return SIZE_MAX; /* Invalid unicode sequence */
-                    }
-                }
-                s += 4; /* Skip the 4 hex digits */
-                break;
-            default:
-                return SIZE_MAX; /* Invalid escape sequence */
-            }
-        } else if (ch >= 0 && ch <= 0x1f) {
-            return SIZE_MAX; /* Unescaped control character */
-        } else {
-            byte_count += 1;
-        }
-        
-        /* Check for potential overflow */
-        if (byte_count > MAX_JSON_STRING_LEN) {
-            return SIZE_MAX;
-        }
-    }
-    
-    if (ch != '"') {
-        return SIZE_MAX; /* Unterminated string */
-    }
-    
-    *actual_len = char_count;
-    return byte_count;
-}
-
 static void json2berry(bvm *vm, const char *class)
 {
     be_getbuiltin(vm, class);
@@ -137,202 +114,222 @@ static void json2berry(bvm *vm, const char *class)
     be_pop(vm, 2);
 }
 
-static const char* parser_true(bvm *vm, const char *json)
+static bbool input_init(bvm *vm, jinput *in, int index)
 {
-    if (!strncmp(json, "true", 4)) {
-        be_pushbool(vm, btrue);
-        return json + 4;
+    in->vm = vm;
+    in->buf = in->tmp = NULL;
+    in->size = in->tmpsize = 0;
+    in->mode = SCAN_BUILD;
+    in->callback = 0;
+    be_stack_require(vm, 2 + BE_STACK_FREE_MIN);
+    be_pushnil(vm); /* placeholder of the window buffer */
+    in->bufidx = be_absindex(vm, -1);
+    be_pushnil(vm); /* placeholder of the decode buffer */
+    in->tmpidx = be_absindex(vm, -1);
+    if (be_isstring(vm, index)) {
+        in->s = be_tostring(vm, index);
+        in->end = in->s + be_strlen(vm, index);
+        in->stream = 0;
+        return btrue;
+    }
+    if (be_isinstance(vm, index)) {
+        bbool readable = be_getmember(vm, index, "read") && be_isfunction(vm, -1);
+        be_pop(vm, 1);
+        in->s = in->end = "";
+        in->stream = be_absindex(vm, index);
+        return readable;
     }
-    return NULL;
+    return bfalse;
 }
 
-static const char* parser_false(bvm *vm, const char *json)
+/* replace the buffer at stack index 'idx' with a larger one, keeping 'len' bytes from 'data' */
+static char* grow_buffer(bvm *vm, int idx, size_t size, const char *data, size_t len)
 {
-    if (!strncmp(json, "false", 5)) {
-        be_pushbool(vm, bfalse);
-        return json + 5;
+    char *buf;
+    be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
+    buf = be_pushbuffer(vm, size);
+    if (len) {
+        memcpy(buf, data, len);
     }
-    return NULL;
+    be_moveto(vm, -1, idx);
+    be_pop(vm, 1);
+    return buf;
 }
 
-static const char* parser_null(bvm *vm, const char *json)
+/* read more data from the stream, keeping the current token in the window */
+static bbool input_more(jinput *in)
 {
-    if (!strncmp(json, "null", 4)) {
-        be_pushnil(vm);
-        return json + 4;
-    }
-    return NULL;
+    bvm *vm = in->vm;
+    size_t used = in->end - in->s, len = 0;
+    if (!in->stream) {
+        return bfalse;
+    }
+    if (used + STREAM_CHUNK_SIZE > in->size) {
+        size_t size = in->size ? in->size : STREAM_CHUNK_SIZE;
+        while (size < used + STREAM_CHUNK_SIZE) {
+            size <<= 1;
+        }
+        in->buf = grow_buffer(vm, in->bufidx, size, in->s, used);
+        in->size = size;
+    } else {
+        memmove(in->buf, in->s, used);
+    }
+    be_stack_require(vm, 3 + BE_STACK_FREE_MIN);
+    be_getmember(vm, in->stream, "read");
+    be_pushvalue(vm, in->stream);
+    be_pushint(vm, (bint)(in->size - used));
+    be_call(vm, 2);
+    if (be_isstring(vm, -3)) {
+        len = be_strlen(vm, -3);
+        len = len < in->size - used ? len : in->size - used;
+        memcpy(in->buf + used, be_tostring(vm, -3), len);
+    }
+    be_pop(vm, 3);
+    in->buf[used + len] = '\0';
+    in->s = in->buf;
+    in->end = in->buf + used + len;
+    if (len == 0) {
+        in->stream = 0; /* end of stream */
+    }
+    return len > 0;
 }
 
-static const char* parser_string(bvm *vm, const char *json)
+/* character at offset 'n' from the start of the current token, '\0' at the end of input */
+static int input_peek(jinput *in, size_t n)
 {
-    if (*json != '"') {
-        return NULL;
-    }
-    
-    size_t char_len;
-    size_t byte_len = json_strlen_safe(json, &char_len);
-    
-    if (byte_len == SIZE_MAX) {
-        return NULL; /* Invalid or too long string */
-    }
-    
-    if (byte_len == 0) {
-        /* Empty string */
-        be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
-        be_pushstring(vm, "");
-        return json + 2; /* Skip opening and closing quotes */
-    }
-    
-    /* Allocate buffer - size is correctly calculated by json_strlen_safe */
-    char *buf = be_malloc(vm, byte_len + 1);
-    if (!buf) {
-        return NULL; /* Out of memory */
-    }
-    
-    char *dst = buf;
-    const char *src = json + 1; /* Skip opening quote */
-    int ch;
-    
-    while ((ch = *src) != '\0' && ch != '"') {
-        ++src;
-        if (ch == '\\') {
-            ch = *src++;
-            switch (ch) {
-            case '"': 
-                *dst++ = '"'; 
-                break;
-            case '\\': 
-                *dst++ = '\\'; 
-                break;
-            case '/': 
-                *dst++ = '/'; 
-                break;
-            case 'b': 
-                *dst++ = '\b'; 
-                break;
-            case 'f': 
-                *dst++ = '\f'; 
-                break;
-            case 'n': 
-                *dst++ = '\n'; 
-                break;
-            case 'r': 
-                *dst++ = '\r'; 
-                break;
-            case 't': 
-                *dst++ = '\t'; 
-                break;
-            case 'u': {
-                dst = be_load_unicode(dst, src);
-                if (dst == NULL) {
-                    be_free(vm, buf, byte_len + 1);
-                    return NULL;
-                }
-                src += 4;
-                break;
-            }
-            default: 
-                be_free(vm, buf, byte_len + 1);
-                return NULL; /* Invalid escape */
-            }
-        } else if (ch >= 0 && ch <= 0x1f) {
-            be_free(vm, buf, byte_len + 1);
-            return NULL; /* Unescaped control character */
-        } else {
-            *dst++ = (char)ch;
+    while (in->s + n >= in->end) {
+        if (!input_more(in)) {
+            return '\0';
         }
     }
-    
-    if (ch != '"') {
-        be_free(vm, buf, byte_len + 1);
-        return NULL; /* Unterminated string */
+    return (unsigned char)in->s[n];
+}
+
+static bbool input_at_end(jinput *in)
+{
+    return input_peek(in, 0) == '\0' && in->s == in->end;
+}
+
+static void skip_space(jinput *in)
+{
+    while (is_space(input_peek(in, 0))) {
+        ++in->s;
     }
-    
-    /* Success - create Berry string */
-    be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
-    be_pushnstring(vm, buf, (size_t)(dst - buf));
-    be_free(vm, buf, byte_len + 1);
-    return src + 1; /* Skip closing quote */
 }
 
-static const char* parser_field(bvm *vm, const char *json)
+/* skip the expected character after optional spaces */
+static bbool match_char(jinput *in, int ch)
 {
-    be_stack_require(vm, 2 + BE_STACK_FREE_MIN);
-    if (json && *json == '"') {
-        json = parser_string(vm, json);
-        if (json) {
-            json = match_char(json, ':');
-            if (json) {
-                json = parser_value(vm, json);
-                if (json) {
-                    be_data_insert(vm, -3);
-                    be_pop(vm, 2); /* pop key and value */
-                    return json;
-                }
-            }
-            be_pop(vm, 1); /* pop key */
-        }
+    skip_space(in);
+    if (input_peek(in, 0) == ch) {
+        ++in->s;
+        return btrue;
     }
-    return NULL;
+    return bfalse;
 }
 
-static const char* parser_object(bvm *vm, const char *json)
+/* call the json.scan() callback, with the value on top of the stack if 'hasvalue' */
+static int scan_event(jinput *in, int event, bbool hasvalue)
 {
-    json = match_char(json, '{');
-    be_newmap(vm);
-    if (*json != '}') {
-        const char *s;
-        json = parser_field(vm, json);
-        if (json == NULL) {
-            be_pop(vm, 1); /* pop map */
-            return NULL;
-        }
-        while ((s = match_char(json, ',')) != NULL) {
-            json = parser_field(vm, s);
-            if (json == NULL) {
-                be_pop(vm, 1); /* pop map */
-                return NULL;
-            }
-        }
+    bvm *vm = in->vm;
+    bbool stop;
+    be_stack_require(vm, 3 + BE_STACK_FREE_MIN);
+    be_pushvalue(vm, in->callback);
+    be_pushint(vm, event);
+    if (hasvalue) {
+        be_pushvalue(vm, -3);
+    } else {
+        be_pushnil(vm);
     }
-    if ((json = match_char(json, '}')) == NULL) {
-        be_pop(vm, 1); /* pop map */
-        return NULL;
+    be_call(vm, 2);
+    stop = be_isbool(vm, -3) && !be_tobool(vm, -3); /* returned 'false' */
+    be_pop(vm, hasvalue ? 4 : 3);
+    return stop ? SCAN_STOP : SCAN_OK;
+}
+
+/* push a scalar value in build mode, or pass it to the callback */
+static int scan_scalar(jinput *in)
+{
+    return in->mode == SCAN_EVENTS ? scan_event(in, JSON_VALUE, btrue) : SCAN_OK;
+}
+
+static bbool scan_literal(jinput *in, const char *literal, size_t len)
+{
+    size_t i;
+    for (i = 0; i < len; ++i) {
+        if (input_peek(in, i) != literal[i]) {
+            return bfalse;
+        }
     }
-    json2berry(vm, "map");
-    return json;
+    in->s += len;
+    return btrue;
 }
 
-static const char* parser_array(bvm *vm, const char *json)
+/* scan a string, validating it in one pass before decoding it if 'push' is set */
+static bbool scan_string(jinput *in, bbool push)
 {
-    json = match_char(json, '[');
-    be_newlist(vm);
-    if (*json != ']') {
-        const char *s;
-        json = parser_value(vm, json);
-        if (json == NULL) {
-            be_pop(vm, 1); /* pop map */
-            return NULL;
+    size_t n = 1, count = 0;
+    bbool escaped = bfalse;
+    int ch;
+    while ((ch = input_peek(in, n)) != '"') {
+        if (ch <= 0x1f || ++count > MAX_JSON_STRING_LEN) {
+            return bfalse; /* end of input, control character or too long */
         }
-        be_data_push(vm, -2);
-        be_pop(vm, 1); /* pop value */
-        while ((s = match_char(json, ',')) != NULL) {
-            json = parser_value(vm, s);
-            if (json == NULL) {
-                be_pop(vm, 1); /* pop map */
-                return NULL;
+        if (ch == '\\') {
+            escaped = btrue;
+            switch (input_peek(in, ++n)) {
+            case '"': case '\\': case '/':
+            case 'b': case 'f': case 'n': case 'r': case 't':
+                break;
+            case 'u': {
+                int i;
+                for (i = 1; i <= 4; ++i) {
+                    if (!isxdigit(input_peek(in, n + i))) {
+                        return bfalse; /* invalid unicode sequence */
+                    }
+                }
+                n += 4;
+                break;
+            }
+            default:
+                return bfalse; /* invalid escape sequence */
             }
-            be_data_push(vm, -2);
-            be_pop(vm, 1); /* pop value */
         }
+        ++n;
     }
-    if ((json = match_char(json, ']')) == NULL) {
-        be_pop(vm, 1); /* pop map */
-        return NULL;
+    /* the whole string is now in the window, from in->s to the closing quote at in->s[n] */
+    if (push) {
+        bvm *vm = in->vm;
+        const char *src = in->s + 1, *end = in->s + n;
+        be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
+        if (!escaped) {
+            be_pushnstring(vm, src, n - 1);
+        } else {
+            char *dst;
+            if (in->tmpsize < n) { /* the decoded string is never longer than the source */
+                in->tmp = grow_buffer(vm, in->tmpidx, n, NULL, 0);
+                in->tmpsize = n;
+            }
+            for (dst = in->tmp; src < end; ) {
+                if ((ch = *src++) != '\\') {
+                    *dst++ = (char)ch;
+                    continue;
+                }
+                switch (ch = *src++) {
+                case 'b': *dst++ = '\b'; break;
+                case 'f': *dst++ = '\f'; break;
+                case 'n': *dst++ = '\n'; break;
+                case 'r': *dst++ = '\r'; break;
+                case 't': *dst++ = '\t'; break;
+                case 'u': dst = be_load_unicode(dst, src); src += 4; break;
+                default: *dst++ = (char)ch; break; /* '"', '\\' or '/' */
+                }
+            }
+            be_pushnstring(vm, in->tmp, dst - in->tmp);
+        }
     }
-    json2berry(vm, "list");
-    return json;
+    in->s += n + 1;
+    return btrue;
 }
 
 enum {
@@ -427,207 +424,475 @@ int check_json_number(const char *json) {
     }
 }
 
-static const char* parser_number(bvm *vm, const char *json)
+
+static bbool scan_number(jinput *in, bbool push)
 {
     const char *endstr = NULL;
-    int number_type = check_json_number(json);
-    
-    switch (number_type) {
-    case JSON_NUMBER_INTEGER:
-        be_pushint(vm, be_str2int(json, &endstr));
+    size_t n = 0;
+    int ch;
+    while ((ch = input_peek(in, n)) != '\0' && (is_digit(ch) || ch == '-'
+        || ch == '+' || ch == '.' || ch == 'e' || ch == 'E')) {
+        ++n;
+    }
+    /* the number and the character following it are now in the window */
+    switch (check_json_number(in->s)) {
+    case JSON_NUMBER_INTEGER: {
+        bint v = be_str2int(in->s, &endstr);
+        if (push) {
+            be_pushint(in->vm, v);
+        }
         break;
-    case JSON_NUMBER_REAL:
-        be_pushreal(vm, be_str2real(json, &endstr));
+    }
+    case JSON_NUMBER_REAL: {
+        breal v = be_str2real(in->s, &endstr);
+        if (push) {
+            be_pushreal(in->vm, v);
+        }
         break;
+    }
     default:
-        endstr = NULL;
+        return bfalse;
+    }
+    in->s += n;
+    return endstr == in->s; /* integers out of range are not fully converted */
+}
+
+static int scan_object(jinput *in)
+{
+    bvm *vm = in->vm;
+    int res;
+    ++in->s; /* skip '{' */
+    if (in->mode == SCAN_BUILD) {
+        be_stack_require(vm, 2 + BE_STACK_FREE_MIN);
+        be_newmap(vm);
+    } else if (in->mode == SCAN_EVENTS && (res = scan_event(in, JSON_START_OBJECT, bfalse)) != SCAN_OK) {
+        return res;
+    }
+    if (!match_char(in, '}')) {
+        do {
+            skip_space(in);
+            if (input_peek(in, 0) != '"' || !scan_string(in, in->mode != SCAN_SKIP)) {
+                return SCAN_ERROR;
+            }
+            if (in->mode == SCAN_EVENTS && (res = scan_event(in, JSON_KEY, btrue)) != SCAN_OK) {
+                return res;
+            }
+            if (!match_char(in, ':')) {
+                return SCAN_ERROR;
+            }
+            if ((res = scan_value(in)) != SCAN_OK) {
+                return res;
+            }
+            if (in->mode == SCAN_BUILD) {
+                be_data_insert(vm, -3);
+                be_pop(vm, 2); /* pop key and value */
+            }
+        } while (match_char(in, ','));
+        if (!match_char(in, '}')) {
+            return SCAN_ERROR;
+        }
+    }
+    if (in->mode == SCAN_BUILD) {
+        json2berry(vm, "map");
+    } else if (in->mode == SCAN_EVENTS) {
+        return scan_event(in, JSON_END_OBJECT, bfalse);
     }
-    return endstr;
+    return SCAN_OK;
 }
 
-/* parser json value */
-static const char* parser_value(bvm *vm, const char *json)
+static int scan_array(jinput *in)
 {
-    json = skip_space(json);
+    bvm *vm = in->vm;
+    int res;
+    ++in->s; /* skip '[' */
+    if (in->mode == SCAN_BUILD) {
+        be_stack_require(vm, 2 + BE_STACK_FREE_MIN);
+        be_newlist(vm);
+    } else if (in->mode == SCAN_EVENTS && (res = scan_event(in, JSON_START_ARRAY, bfalse)) != SCAN_OK) {
+        return res;
+    }
+    if (!match_char(in, ']')) {
+        do {
+            if ((res = scan_value(in)) != SCAN_OK) {
+                return res;
+            }
+            if (in->mode == SCAN_BUILD) {
+                be_data_push(vm, -2);
+                be_pop(vm, 1); /* pop value */
+            }
+        } while (match_char(in, ','));
+        if (!match_char(in, ']')) {
+            return SCAN_ERROR;
+        }
+    }
+    if (in->mode == SCAN_BUILD) {
+        json2berry(vm, "list");
+    } else if (in->mode == SCAN_EVENTS) {
+        return scan_event(in, JSON_END_ARRAY, bfalse);
+    }
+    return SCAN_OK;
+}
+
+/* scan json value */
+static int scan_value(jinput *in)
+{
+    bvm *vm = in->vm;
+    bbool push = in->mode != SCAN_SKIP;
+    int ch;
+    skip_space(in);
     /*
-      Each value will push at least one thig to the stack, so we must ensure it's big enough.
-      We need to take special care to extend the stack in values which have variable length (arrays and objects)
+      Each value will push at least one thing to the stack, so we must ensure it's big enough.
+      Arrays and objects extend the stack for their elements.
     */
     be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
-    switch (*json) {
+    switch (ch = input_peek(in, 0)) {
     case '{': /* object */
-        return parser_object(vm, json);
+        return scan_object(in);
     case '[': /* array */
-        return parser_array(vm, json);
+        return scan_array(in);
     case '"': /* string */
-        return parser_string(vm, json);
+        return scan_string(in, push) ? scan_scalar(in) : SCAN_ERROR;
     case 't': /* true */
-        return parser_true(vm, json);
+        if (!scan_literal(in, "true", 4)) {
+            return SCAN_ERROR;
+        }
+        if (push) {
+            be_pushbool(vm, btrue);
+        }
+        return scan_scalar(in);
     case 'f': /* false */
-        return parser_false(vm, json);
+        if (!scan_literal(in, "false", 5)) {
+            return SCAN_ERROR;
+        }
+        if (push) {
+            be_pushbool(vm, bfalse);
+        }
+        return scan_scalar(in);
     case 'n': /* null */
-        return parser_null(vm, json);
+        if (!scan_literal(in, "null", 4)) {
+            return SCAN_ERROR;
+        }
+        if (push) {
+            be_pushnil(vm);
+        }
+        return scan_scalar(in);
     default: /* number */
-        if (*json == '-' || is_digit(*json)) {
-           return parser_number(vm, json);
+        if ((ch == '-' || is_digit(ch)) && scan_number(in, push)) {
+            return scan_scalar(in);
+        }
+    }
+    return SCAN_ERROR;
+}
+
+/* move to the value of 'key' in the object at the current position */
+static bbool scan_field(jinput *in, const char *key, size_t len)
+{
+    bvm *vm = in->vm;
+    if (!match_char(in, '{')) {
+        return bfalse;
+    }
+    do {
+        bbool found;
+        skip_space(in);
+        if (input_peek(in, 0) != '"' || !scan_string(in, btrue)) {
+            return bfalse; /* also when the object is empty */
+        }
+        found = (size_t)be_strlen(vm, -1) == len && !memcmp(be_tostring(vm, -1), key, len);
+        be_pop(vm, 1);
+        if (!match_char(in, ':')) {
+            return bfalse;
+        }
+        if (found) {
+            return btrue;
+        }
+        if (scan_value(in) != SCAN_OK) {
+            return bfalse;
+        }
+    } while (match_char(in, ','));
+    return bfalse;
+}
+
+/* move to the element 'index' of the array at the current position */
+static bbool scan_element(jinput *in, bint index)
+{
+    if (index < 0 || !match_char(in, '[')) {
+        return bfalse;
+    }
+    while (index-- > 0) {
+        if (scan_value(in) != SCAN_OK || !match_char(in, ',')) {
+            return bfalse;
+        }
+    }
+    skip_space(in);
+    return input_peek(in, 0) != ']';
+}
+
+/* move to the value at 'path', a list of object keys and array indexes,
+ * skipping all values before it without building them */
+static bbool scan_path(jinput *in, int path)
+{
+    bvm *vm = in->vm;
+    int i, count;
+    bbool found = btrue;
+    in->mode = SCAN_SKIP;
+    be_stack_require(vm, 3 + BE_STACK_FREE_MIN);
+    be_getmember(vm, path, ".p");
+    count = be_data_size(vm, -1);
+    for (i = 0; found && i < count; ++i) {
+        be_pushint(vm, i);
+        be_getindex(vm, -2);
+        if (be_isstring(vm, -1)) {
+            found = scan_field(in, be_tostring(vm, -1), be_strlen(vm, -1));
+        } else if (be_isint(vm, -1)) {
+            found = scan_element(in, be_toint(vm, -1));
+        } else {
+            found = bfalse;
         }
+        be_pop(vm, 2); /* pop index and key */
     }
-    return NULL;
+    be_pop(vm, 1); /* pop path list */
+    in->mode = SCAN_BUILD;
+    return found;
 }
 
+/* json.load(source [, path]) -> value or nil
+ * 'source' is a string or a stream with a 'read(size)' method such as a file.
+ * With 'path', only the value at the path is built and the rest of the
+ * document after it is not read. */
 static int m_json_load(bvm *vm)
 {
-    if (be_isstring(vm, 1)) {
-        const char *json = be_tostring(vm, 1);
-        json = parser_value(vm, json);
-        if (json != NULL && *json == '\0') {
-            be_return(vm);
+    jinput in;
+    int argc = be_top(vm);
+    if (argc >= 1 && input_init(vm, &in, 1)) {
+        if (argc >= 2 && !be_isnil(vm, 2)) {
+            if (is_object(vm, "list", 2) && scan_path(&in, 2) && scan_value(&in) == SCAN_OK) {
+                be_return(vm);
+            }
+        } else if (scan_value(&in) == SCAN_OK) {
+            skip_space(&in);
+            if (input_at_end(&in)) {
+                be_return(vm);
+            }
         }
     }
     be_return_nil(vm);
 }
 
-static void make_indent(bvm *vm, int stridx, int indent)
+/* json.scan(source, callback) -> bool
+ * Calls 'callback(event, value)' for each token of the document without
+ * building it, 'value' is the key or the value for KEY and VALUE events.
+ * Scanning stops if the callback returns 'false'. Returns false if the
+ * document is invalid, true otherwise. */
+static int m_json_scan(bvm *vm)
 {
-    if (indent) {
-        be_stack_require(vm, 1 + BE_STACK_FREE_MIN); 
-        char buf[MAX_INDENT * INDENT_WIDTH + 1];
-        indent = (indent < MAX_INDENT ? indent : MAX_INDENT) * INDENT_WIDTH;
-        memset(buf, INDENT_CHAR, indent);
-        buf[indent] = '\0';
-        stridx = be_absindex(vm, stridx);
-        be_pushstring(vm, buf);
-        be_strconcat(vm, stridx);
-        be_pop(vm, 1);
+    jinput in;
+    if (be_top(vm) >= 2 && be_isfunction(vm, 2) && input_init(vm, &in, 1)) {
+        int res;
+        in.mode = SCAN_EVENTS;
+        in.callback = 2;
+        res = scan_value(&in);
+        if (res == SCAN_OK) {
+            skip_space(&in);
+            res = input_at_end(&in) ? SCAN_OK : SCAN_ERROR;
+        }
+        be_pushbool(vm, res != SCAN_ERROR);
+        be_return(vm);
     }
+    be_return_nil(vm);
 }
 
-void string_dump(bvm *vm, int index)
+static void writer_reserve(jwriter *w, size_t len)
 {
-    be_stack_require(vm, 1 + BE_STACK_FREE_MIN); 
-    be_tostring(vm, index); /* convert value to string */
-    be_toescape(vm, index, 'u');
-    be_pushvalue(vm, index);
+    if (w->len + len > w->size) {
+        size_t size = w->size;
+        while (size < w->len + len) {
+            size <<= 1;
+        }
+        w->buf = grow_buffer(w->vm, w->bufidx, size, w->buf, w->len);
+        w->size = size;
+    }
 }
 
-static void object_dump(bvm *vm, int *indent, int idx, int fmt)
+static void writer_append(jwriter *w, const char *s, size_t len)
 {
+    writer_reserve(w, len);
+    memcpy(w->buf + w->len, s, len);
+    w->len += len;
+}
+
+static void writer_indent(jwriter *w)
+{
+    if (w->fmt && w->indent) {
+        int indent = (w->indent < MAX_INDENT ? w->indent : MAX_INDENT) * INDENT_WIDTH;
+        writer_reserve(w, indent);
+        memset(w->buf + w->len, INDENT_CHAR, indent);
+        w->len += indent;
+    }
+}
 
-    be_stack_require(vm, 3 + BE_STACK_FREE_MIN); /* 3 pushes outside the loop */
+static int eschex(int num)
+{
+    return num <= 9 ? '0' + num : 'a' + num - 10;
+}
+
+/* write an escaped string, copying runs of unescaped characters at once */
+static void string_dump(jwriter *w, const char *s, size_t len)
+{
+    size_t i, start = 0;
+    writer_reserve(w, len + 2);
+    w->buf[w->len++] = '"';
+    for (i = 0; i < len; ++i) {
+        int c = (unsigned char)s[i];
+        if (c < 0x20 || c == '"' || c == '\\') {
+            char esc[6] = { '\\', (char)c };
+            size_t esclen = 2;
+            switch (c) {
+            case '"': case '\\': break;
+            case '\n': esc[1] = 'n'; break;
+            case '\r': esc[1] = 'r'; break;
+            case '\t': esc[1] = 't'; break;
+            default: /* other characters are escaped using '\u00xx' */
+                esc[1] = 'u'; esc[2] = '0'; esc[3] = '0';
+                esc[4] = (char)eschex(c >> 4);
+                esc[5] = (char)eschex(c & 0x0f);
+                esclen = 6;
+                break;
+            }
+            writer_append(w, s + start, i - start);
+            writer_append(w, esc, esclen);
+            start = i + 1;
+        }
+    }
+    writer_append(w, s + start, len - start);
+    writer_append(w, "\"", 1);
+}
+
+/* write a value converted with 'tostring()' as a string */
+static void tostring_dump(jwriter *w, int idx)
+{
+    bvm *vm = w->vm;
+    be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
+    be_pushvalue(vm, idx);
+    be_tostring(vm, -1);
+    string_dump(w, be_tostring(vm, -1), be_strlen(vm, -1));
+    be_pop(vm, 1);
+}
+
+static void object_dump(jwriter *w, int idx)
+{
+    bvm *vm = w->vm;
+    be_stack_require(vm, 4 + BE_STACK_FREE_MIN);
     be_getmember(vm, idx, ".p");
-    be_pushstring(vm, fmt ? "{\n" : "{");
-    be_pushiter(vm, -2); /* map iterator use 1 register */
-    *indent += fmt;
-    while (be_iter_hasnext(vm, -3)) {
-        be_stack_require(vm, 3 + BE_STACK_FREE_MIN); /* 3 pushes inside the loop */
-        make_indent(vm, -2, fmt ? *indent : 0);
-        be_iter_next(vm, -3);
-        /* key.tostring() */
-        string_dump(vm, -2);
-        be_strconcat(vm, -5);
-        be_pop(vm, 1);
-        be_pushstring(vm, fmt ? ": " : ":"); /* add ': ' */
-        be_strconcat(vm, -5);
-        be_pop(vm, 1);
-        /* value.tostring() */
-        value_dump(vm, indent, -1, fmt);
-        be_strconcat(vm, -5);
-        be_pop(vm, 3);
-        if (be_iter_hasnext(vm, -3)) {
-            be_pushstring(vm, fmt ? ",\n" : ",");
-            be_strconcat(vm, -3);
-            be_pop(vm, 1);
-        } else if (fmt) {
-            be_pushstring(vm, "\n");
-            be_strconcat(vm, -3);
-            be_pop(vm, 1);
-        }
-    }
-    *indent -= fmt;
-    be_pop(vm, 1); /* pop iterator */
-    make_indent(vm, -1,  fmt ? *indent : 0);
-    be_pushstring(vm, "}");
-    be_strconcat(vm, -2);
-    be_moveto(vm, -2, -3);
-    be_pop(vm, 2);
+    be_pushiter(vm, -1); /* map iterator use 1 register */
+    writer_append(w, w->fmt ? "{\n" : "{", w->fmt ? 2 : 1);
+    w->indent += w->fmt;
+    while (be_iter_hasnext(vm, -2)) {
+        writer_indent(w);
+        be_iter_next(vm, -2);
+        tostring_dump(w, -2); /* key */
+        writer_append(w, w->fmt ? ": " : ":", w->fmt ? 2 : 1);
+        value_dump(w, -1);
+        be_pop(vm, 2); /* pop key and value */
+        if (be_iter_hasnext(vm, -2)) {
+            writer_append(w, w->fmt ? ",\n" : ",", w->fmt ? 2 : 1);
+        } else if (w->fmt) {
+            writer_append(w, "\n", 1);
+        }
+    }
+    w->indent -= w->fmt;
+    be_pop(vm, 2); /* pop iterator and map */
+    writer_indent(w);
+    writer_append(w, "}", 1);
 }
 
-static void array_dump(bvm *vm, int *indent, int idx, int fmt)
+static void array_dump(jwriter *w, int idx)
 {
-    be_stack_require(vm, 3 + BE_STACK_FREE_MIN); 
+    bvm *vm = w->vm;
+    be_stack_require(vm, 3 + BE_STACK_FREE_MIN);
     be_getmember(vm, idx, ".p");
-    be_pushstring(vm, fmt ? "[\n" : "[");
-    be_pushiter(vm, -2);
-    *indent += fmt;
-    while (be_iter_hasnext(vm, -3)) {
-        make_indent(vm, -2,  fmt ? *indent : 0);
-        be_iter_next(vm, -3);
-        value_dump(vm, indent, -1, fmt);
-        be_strconcat(vm, -4);
-        be_pop(vm, 2);
-        be_stack_require(vm, 1 + BE_STACK_FREE_MIN); 
-        if (be_iter_hasnext(vm, -3)) {
-            be_pushstring(vm, fmt ? ",\n" : ",");
-            be_strconcat(vm, -3);
-            be_pop(vm, 1);
-        } else if (fmt) {
-            be_pushstring(vm, "\n");
-            be_strconcat(vm, -3);
-            be_pop(vm, 1);
-        }
-    }
-    *indent -= fmt;
-    be_pop(vm, 1); /* pop iterator */
-    make_indent(vm, -1,  fmt ? *indent : 0);
-    be_pushstring(vm, "]");
-    be_strconcat(vm, -2);
-    be_moveto(vm, -2, -3);
-    be_pop(vm, 2);
+    be_pushiter(vm, -1);
+    writer_append(w, w->fmt ? "[\n" : "[", w->fmt ? 2 : 1);
+    w->indent += w->fmt;
+    while (be_iter_hasnext(vm, -2)) {
+        writer_indent(w);
+        be_iter_next(vm, -2);
+        value_dump(w, -1);
+        be_pop(vm, 1); /* pop value */
+        if (be_iter_hasnext(vm, -2)) {
+            writer_append(w, w->fmt ? ",\n" : ",", w->fmt ? 2 : 1);
+        } else if (w->fmt) {
+            writer_append(w, "\n", 1);
+        }
+    }
+    w->indent -= w->fmt;
+    be_pop(vm, 2); /* pop iterator and list */
+    writer_indent(w);
+    writer_append(w, "]", 1);
 }
 
-static void value_dump(bvm *vm, int *indent, int idx, int fmt)
+static void value_dump(jwriter *w, int idx)
 {
-    // be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
+    bvm *vm = w->vm;
+    char buf[32];
+    idx = be_absindex(vm, idx);
     if (is_object(vm, "map", idx)) { /* convert to json object */
-        object_dump(vm, indent, idx, fmt);
+        object_dump(w, idx);
     } else if (is_object(vm, "list", idx)) { /* convert to json array */
-        array_dump(vm, indent, idx, fmt);
+        array_dump(w, idx);
     } else if (be_isnil(vm, idx)) { /* convert to json null */
-        be_stack_require(vm, 1 + BE_STACK_FREE_MIN); 
-        be_pushstring(vm, "null");
+        writer_append(w, "null", 4);
     } else if (be_isreal(vm, idx)) {
-        be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
         breal v = be_toreal(vm, idx);
         if (isnan(v) || isinf(v)) {
-            be_pushstring(vm, "null");
+            writer_append(w, "null", 4);
+        } else {
+            writer_append(w, buf, snprintf(buf, sizeof(buf), "%g", v));
+        }
+    } else if (be_isint(vm, idx)) { /* convert to json number */
+        writer_append(w, buf, snprintf(buf, sizeof(buf), BE_INT_FORMAT, be_toint(vm, idx)));
+    } else if (be_isbool(vm, idx)) { /* convert to json boolean */
+        if (be_tobool(vm, idx)) {
+            writer_append(w, "true", 4);
         } else {
-            be_tostring(vm, idx);
-            be_pushvalue(vm, idx); /* push to top */
-        };
-    } else if (be_isnumber(vm, idx) || be_isbool(vm, idx)) { /* convert to json number and boolean */
-        be_stack_require(vm, 1 + BE_STACK_FREE_MIN); 
-        be_tostring(vm, idx);
-        be_pushvalue(vm, idx); /* push to top */
+            writer_append(w, "false", 5);
+        }
+    } else if (be_isstring(vm, idx)) {
+        string_dump(w, be_tostring(vm, idx), be_strlen(vm, idx));
     } else { /* convert to string */
-        string_dump(vm, idx);
+        tostring_dump(w, idx);
     }
 }
 
+/* json.dump(value [, "format"]) -> string
+ * The output is written to a single growing buffer. */
 static int m_json_dump(bvm *vm)
 {
-    int indent = 0, argc = be_top(vm);
-    int fmt = 0;
-    if (argc > 1) {
-        fmt = !strcmp(be_tostring(vm, 2), "format");
-    }
-    value_dump(vm, &indent, 1, fmt);
+    jwriter w;
+    int argc = be_top(vm);
+    w.vm = vm;
+    w.fmt = argc > 1 && !strcmp(be_tostring(vm, 2), "format");
+    w.indent = 0;
+    w.len = 0;
+    w.size = WRITER_INIT_SIZE;
+    be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
+    w.buf = be_pushbuffer(vm, w.size);
+    w.bufidx = be_absindex(vm, -1);
+    value_dump(&w, 1);
+    be_pushnstring(vm, w.buf, w.len);
     be_return(vm);
 }
 
 #if !BE_USE_PRECOMPILED_OBJECT
 be_native_module_attr_table(json) {
     be_native_module_function("load", m_json_load),
-    be_native_module_function("dump", m_json_dump)
+    be_native_module_function("dump", m_json_dump),
+    be_native_module_function("scan", m_json_scan),
+    be_native_module_int("START_OBJECT", JSON_START_OBJECT),
+    be_native_module_int("END_OBJECT", JSON_END_OBJECT),
+    be_native_module_int("START_ARRAY", JSON_START_ARRAY),
+    be_native_module_int("END_ARRAY", JSON_END_ARRAY),
+    be_native_module_int("KEY", JSON_KEY),
+    be_native_module_int("VALUE", JSON_VALUE)
 };
 
 be_define_native_module(json, NULL);
@@ -636,6 +901,13 @@ be_define_native_module(json, NULL);
 module json (scope: global, depend: BE_USE_JSON_MODULE) {
     load, func(m_json_load)
     dump, func(m_json_dump)
+    scan, func(m_json_scan)
+    START_OBJECT, int(JSON_START_OBJECT)
+    END_OBJECT, int(JSON_END_OBJECT)
+    START_ARRAY, int(JSON_START_ARRAY)
+    END_ARRAY, int(JSON_END_ARRAY)
+    KEY, int(JSON_KEY)
+    VALUE, int(JSON_VALUE)
 }
 @const_object_info_end */
 #include "../generate/be_fixed_json.h"
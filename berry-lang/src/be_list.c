@@ -128,18 +128,23 @@ int be_list_remove(bvm *vm, blist *list, int index)
 
 void be_list_resize(bvm *vm, blist *list, int count)
 {
+    if (count < 0) { /* a negative size empties the list */
+        count = 0;
+    }
     if (count != list->count) {
         int newcap = be_nextsize(count);
+        bvalue *v, *end;
         if (newcap > list->capacity) {
-            bvalue *v, *end;
             list->data = be_realloc(vm, list->data,
                 datasize(list->capacity), datasize(newcap));
             list->capacity = newcap;
-            v = list->data + list->count;
-            end = list->data + count;
-            while (v < end) {
-                var_setnil(v++);
-            }
+        }
+        /* the spare capacity is uninitialized or holds values the GC
+         * stopped marking when the list shrank, clear it */
+        v = list->data + list->count;
+        end = list->data + count;
+        while (v < end) {
+            var_setnil(v++);
         }
         list->count = count;
     }
@@ -9,6 +9,7 @@
 #include "be_string.h"
 #include "be_strlib.h"
 #include "be_list.h"
+#include "be_class.h"
 #include "be_func.h"
 #include "be_exec.h"
 #include "be_vm.h"
@@ -213,35 +214,257 @@ static int m_item(bvm *vm)
     be_return_nil(vm);
 }
 
+/* the class of 'obj' has the method 'name', virtual members excluded */
+static bbool hasmethod(bvm *vm, binstance *obj, const char *name)
+{
+    int type = be_instance_member_simple(vm, obj, be_newstr(vm, name), vm->top);
+    return basetype(type) == BE_FUNCTION;
+}
+
 static int m_find(bvm *vm)
 {
     bbool found = bfalse;
+    bclass *noeq = NULL; /* last class found without '==' method */
+    blist *list;
     int idx;
     be_getmember(vm, 1, ".p");
     list_check_data(vm, 2);
     list_check_ref(vm);
     be_refpush(vm, 1);
-    be_pushiter(vm, -1);
-    for (idx=0; be_iter_hasnext(vm, -2); idx++) {
-        be_iter_next(vm, -2);
-        be_pushvalue(vm, 2);    /* push needle to compare */
-        if (be_iseq(vm)) {
-            found = btrue;
-            be_pop(vm, 2);
-            break;
+    list = var_toobj(be_indexof(vm, -1));
+    /* compare in place, the list may change if an '==' method is called */
+    for (idx = 0; !found && idx < be_list_count(list); idx++) {
+        bvalue *it = be_list_data(list) + idx;
+        if (var_isinstance(it)) {
+            binstance *obj = var_toobj(it);
+            if (be_instance_class(obj) == noeq) {
+                found = var_isinstance(be_indexof(vm, 2)) && var_toobj(be_indexof(vm, 2)) == obj;
+                continue;
+            }
+            if (!hasmethod(vm, obj, "==") && !hasmethod(vm, obj, "member")) {
+                noeq = be_instance_class(obj); /* compares by identity */
+            }
         }
-        be_pop(vm, 2);
+        found = be_vm_iseq(vm, it, be_indexof(vm, 2));
     }
-    be_pop(vm, 1); /* pop iterator */
     be_refpop(vm);
     if (found) {
-        be_pushint(vm, idx);
+        be_pushint(vm, idx - 1);
         be_return(vm);
     } else {
         be_return_nil(vm);
     }
 }
 
+/* index 'i' counted from the end when negative, clamped to 0..size */
+static int list_clampindex(bint i, int size)
+{
+    if (i < 0) {
+        i += size;
+    }
+    return i < 0 ? 0 : (i > size ? size : (int)i);
+}
+
+/* push the sort key of 'value', the value itself or the result of the key
+ * function at stack index 'keyfn' */
+static void push_sortkey(bvm *vm, int keyfn, bvalue value)
+{
+    if (keyfn) {
+        be_pushvalue(vm, keyfn);
+        var_setval(vm->top, &value);
+        be_incrtop(vm);
+        be_call(vm, 1);
+        be_pop(vm, 1);
+    } else {
+        var_setval(vm->top, &value);
+        be_incrtop(vm);
+    }
+}
+
+/* stack index of the key function argument, or 0 */
+static int sort_keyfn(bvm *vm, int index)
+{
+    return be_top(vm) >= index && !be_isnil(vm, index) ? index : 0;
+}
+
+#define SORT_INT        0
+#define SORT_REAL       1
+#define SORT_ANY        2
+#define SORT_RUN        16  /* sorted by insertion before merging */
+
+typedef struct {
+    bvm *vm;
+    bvalue *keys;
+    int mode;
+    bbool reverse;
+} sortinfo;
+
+#define sort_real(v)    (var_isreal(v) ? var_toreal(v) : (breal)var_toint(v))
+
+/* the key 'a' must be placed before 'b' */
+static bbool sort_before(sortinfo *s, int a, int b)
+{
+    bvalue *x = s->keys + a, *y = s->keys + b;
+    if (s->reverse) {
+        bvalue *t = x;
+        x = y;
+        y = t;
+    }
+    switch (s->mode) {
+    case SORT_INT: return var_toint(x) < var_toint(y);
+    case SORT_REAL: return sort_real(x) < sort_real(y);
+    default: return be_vm_islt(s->vm, x, y); /* strings or '<' method */
+    }
+}
+
+/* stable sort of the indexes 'perm' of the keys, 'tmp' is a buffer of the same size */
+static void sort_merge(sortinfo *s, int *perm, int *tmp, int n)
+{
+    int lo, width, i, j, k, *out = perm;
+    for (lo = 0; lo < n; lo += SORT_RUN) { /* insertion sort of the runs */
+        int hi = lo + SORT_RUN < n ? lo + SORT_RUN : n;
+        for (i = lo + 1; i < hi; ++i) {
+            int v = perm[i];
+            for (j = i; j > lo && sort_before(s, v, perm[j - 1]); --j) {
+                perm[j] = perm[j - 1];
+            }
+            perm[j] = v;
+        }
+    }
+    for (width = SORT_RUN; width < n; width <<= 1) {
+        for (lo = 0; lo < n; lo += width << 1) {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = mid + width < n ? mid + width : n;
+            if (mid == hi || !sort_before(s, perm[mid], perm[mid - 1])) {
+                memcpy(tmp + lo, perm + lo, (hi - lo) * sizeof(int)); /* already in order */
+                continue;
+            }
+            for (i = lo, j = mid, k = lo; k < hi; ++k) {
+                if (j >= hi || (i < mid && !sort_before(s, perm[j], perm[i]))) {
+                    tmp[k] = perm[i++];
+                } else {
+                    tmp[k] = perm[j++];
+                }
+            }
+        }
+        int *t = perm;
+        perm = tmp;
+        tmp = t;
+    }
+    if (perm != out) { /* odd number of merge passes */
+        memcpy(out, perm, n * sizeof(int));
+    }
+}
+
+/* sort([key_function, reverse]): stable sort in place */
+static int m_sort(bvm *vm)
+{
+    int i, n, keyfn = sort_keyfn(vm, 2);
+    bbool reverse = be_top(vm) >= 3 && be_tobool(vm, 3);
+    blist *list, *vals, *keys;
+    be_getmember(vm, 1, ".p");
+    list_check_data(vm, 1);
+    list = var_toobj(be_indexof(vm, -1));
+    n = be_list_count(list);
+    if (n > 1) {
+        sortinfo s;
+        int *perm;
+        be_newlist(vm); /* copy of the values, also the keys without key function */
+        be_pushvalue(vm, -2);
+        be_data_merge(vm, -2);
+        be_pop(vm, 1);
+        vals = keys = var_toobj(be_indexof(vm, -1));
+        if (keyfn) {
+            be_newlist(vm);
+            keys = var_toobj(be_indexof(vm, -1));
+            for (i = 0; i < n; ++i) {
+                push_sortkey(vm, keyfn, be_list_data(vals)[i]);
+                be_data_push(vm, -2);
+                be_pop(vm, 1);
+            }
+        }
+        perm = (int*)be_pushbuffer(vm, 2 * n * sizeof(int));
+        s.vm = vm;
+        s.keys = be_list_data(keys);
+        s.reverse = reverse;
+        s.mode = SORT_INT;
+        for (i = 0; i < n; ++i) {
+            bvalue *k = s.keys + i;
+            if (!var_isint(k)) {
+                s.mode = var_isreal(k) ? SORT_REAL : SORT_ANY;
+                if (s.mode == SORT_ANY) {
+                    break;
+                }
+            }
+            perm[i] = i;
+        }
+        for (; i < n; ++i) {
+            perm[i] = i;
+        }
+        sort_merge(&s, perm, perm + n, n);
+        if (be_list_count(list) != n) {
+            be_raise(vm, "runtime_error", "list modified during sort");
+        }
+        for (i = 0; i < n; ++i) {
+            be_list_data(list)[i] = be_list_data(vals)[perm[i]];
+        }
+    }
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
+/* index after the elements with a key lower or equal to the value at
+ * stack index 'value', or greater or equal if reversed */
+static int list_bisect(bvm *vm, blist *list, int value, int keyfn, bbool reverse)
+{
+    int lo = 0, hi = be_list_count(list);
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        bbool before;
+        if (mid >= be_list_count(list)) {
+            be_raise(vm, "runtime_error", "list modified during search");
+        }
+        push_sortkey(vm, keyfn, be_list_data(list)[mid]);
+        before = reverse ? be_vm_islt(vm, be_indexof(vm, -1), be_indexof(vm, value))
+                         : be_vm_islt(vm, be_indexof(vm, value), be_indexof(vm, -1));
+        be_pop(vm, 1);
+        if (before) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+/* bisect(key [, key_function, reverse]): insertion index in a sorted list */
+static int m_bisect(bvm *vm)
+{
+    int keyfn = sort_keyfn(vm, 3);
+    bbool reverse = be_top(vm) >= 4 && be_tobool(vm, 4);
+    be_getmember(vm, 1, ".p");
+    list_check_data(vm, 2);
+    be_pushint(vm, list_bisect(vm, var_toobj(be_indexof(vm, -1)), 2, keyfn, reverse));
+    be_return(vm);
+}
+
+/* insort(value [, key_function, reverse]): insert in a sorted list after the
+ * equal elements, returns the index */
+static int m_insort(bvm *vm)
+{
+    int idx, keyfn = sort_keyfn(vm, 3);
+    bbool reverse = be_top(vm) >= 4 && be_tobool(vm, 4);
+    blist *list;
+    be_getmember(vm, 1, ".p");
+    list_check_data(vm, 2);
+    list = var_toobj(be_indexof(vm, -1));
+    push_sortkey(vm, keyfn, *be_indexof(vm, 2));
+    idx = list_bisect(vm, list, be_absindex(vm, -1), keyfn, reverse);
+    be_list_insert(vm, list, idx, be_indexof(vm, 2));
+    be_pushint(vm, idx);
+    be_return(vm);
+}
+
 static int m_setitem(bvm *vm)
 {
     be_getmember(vm, 1, ".p");
@@ -347,6 +570,59 @@ static int m_merge(bvm *vm)
     be_return(vm); /* return self */
 }
 
+/* extend(list): append the elements of another list */
+static int m_extend(bvm *vm)
+{
+    be_getmember(vm, 1, ".p");
+    list_check_data(vm, 2);
+    be_getmember(vm, 2, ".p");
+    if (!be_islist(vm, -1)) {
+        be_raise(vm, "type_error", "operand must be a list");
+    }
+    be_data_merge(vm, -2);
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
+/* fill(value [, begin, end]): set the elements from begin to end excluded */
+static int m_fill(bvm *vm)
+{
+    int argc = be_top(vm), size, begin, end;
+    bvalue *data;
+    be_getmember(vm, 1, ".p");
+    list_check_data(vm, 2);
+    size = be_data_size(vm, -1);
+    begin = argc >= 3 && be_isint(vm, 3) ? list_clampindex(be_toint(vm, 3), size) : 0;
+    end = argc >= 4 && be_isint(vm, 4) ? list_clampindex(be_toint(vm, 4), size) : size;
+    data = be_list_data(cast(blist*, var_toobj(be_indexof(vm, -1))));
+    for (; begin < end; ++begin) {
+        data[begin] = *be_indexof(vm, 2);
+    }
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
+/* slice(begin [, end]): new list of the elements from begin to end excluded */
+static int m_slice(bvm *vm)
+{
+    int argc = be_top(vm), size, begin, end;
+    blist *src;
+    be_getmember(vm, 1, ".p");
+    list_check_data(vm, 1);
+    src = var_toobj(be_indexof(vm, -1));
+    size = be_list_count(src);
+    begin = argc >= 2 && be_isint(vm, 2) ? list_clampindex(be_toint(vm, 2), size) : 0;
+    end = argc >= 3 && be_isint(vm, 3) ? list_clampindex(be_toint(vm, 3), size) : size;
+    be_newobject(vm, "list"); /* result list */
+    if (begin < end) {
+        blist *dst = var_toobj(be_indexof(vm, -1));
+        be_list_resize(vm, dst, end - begin);
+        memcpy(be_list_data(dst), be_list_data(src) + begin, (end - begin) * sizeof(bvalue));
+    }
+    be_pop(vm, 1);
+    be_return(vm);
+}
+
 static void connect(bvm *vm, bvalue *begin, bvalue *end, const char * delimiter, bbool first_element)
 {
     size_t l0 = be_strlen(vm, -1), len = l0;
@@ -515,6 +791,12 @@ void be_load_listlib(bvm *vm)
         { "reverse", m_reverse },
         { "copy", m_copy },
         { "keys", m_keys },
+        { "sort", m_sort },
+        { "bisect", m_bisect },
+        { "insort", m_insort },
+        { "fill", m_fill },
+        { "slice", m_slice },
+        { "extend", m_extend },
         { "tobool", m_tobool },
         { "..", m_connect },
         { "+", m_merge },
@@ -545,6 +827,12 @@ class be_class_list (scope: global, name: list) {
     reverse, func(m_reverse)
     copy, func(m_copy)
     keys, func(m_keys)
+    sort, func(m_sort)
+    bisect, func(m_bisect)
+    insort, func(m_insort)
+    fill, func(m_fill)
+    slice, func(m_slice)
+    extend, func(m_extend)
     tobool, func(m_tobool)
     .., func(m_connect)
     +, func(m_merge)
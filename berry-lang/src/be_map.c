@@ -33,6 +33,16 @@
 
 #define LASTNODE            ((1 << 24) - 1)
 
+#if BE_USE_MAP_INDEX
+#define BE_MAP_SMALL_SIZE   8           /* maps up to this size have no index */
+#define TAG_EMPTY           0
+#define TAG_REMOVED         1
+#define index_tags(idx)     ((bbyte*)((idx)->pos + (idx)->mask + 1))
+#define index_datasize(n)   (sizeof(bmapindex) + (n) * (sizeof(uint16_t) + 1))
+#define index_mix(hash)     ((hash) * 0x9E3779B1u)  /* spread the bits of int keys */
+#define index_tag(idx, h)   ((bbyte)(0x80 | (((h) >> ((idx)->shift - 7)) & 0x7F)))
+#endif
+
 static int map_nextsize(int size)
 {
     be_assert(size < LASTNODE);
@@ -97,7 +107,7 @@ static uint32_t _hashcode(bvm *vm, int type, union bvaldata v)
     }
 }
 
-static int eqnode(bvm *vm, bmapnode *node, bvalue *key, uint32_t hash)
+static int eqnode(bvm *vm, bmapnode *node, bvalue *key)
 {
     (void)vm;
     if (!var_isnil(key)) {
@@ -110,12 +120,13 @@ static int eqnode(bvm *vm, bmapnode *node, bvalue *key, uint32_t hash)
             return be_vm_iseq(vm, key, &kv);
         }
 #endif
-        if(keytype(k) == key->type && hashcode(k) == hash) {
+        if (keytype(k) == key->type) {
             switch (key->type) {
             case BE_BOOL: return var_tobool(key) == var_tobool(k);
             case BE_INT: return var_toint(key) == var_toint(k);
             case BE_REAL: return var_toreal(key) == var_toreal(k);
-            case BE_STRING: return be_eqstr(var_tostr(key), var_tostr(k));
+            case BE_STRING: /* the same pointer in most cases */
+                return var_tostr(key) == var_tostr(k) || be_eqstr(var_tostr(key), var_tostr(k));
             default: return var_toobj(key) == var_toobj(k);
             }
         }
@@ -123,6 +134,99 @@ static int eqnode(bvm *vm, bmapnode *node, bvalue *key, uint32_t hash)
     return 0;
 }
 
+#if BE_USE_MAP_INDEX
+static void index_add(bmap *map, uint32_t hash, int pos)
+{
+    bmapindex *idx = map->index;
+    uint32_t h = index_mix(hash), b = h >> idx->shift;
+    bbyte *tags = index_tags(idx);
+    while (tags[b] > TAG_REMOVED) {
+        b = (b + 1) & idx->mask;
+    }
+    if (tags[b] == TAG_REMOVED) {
+        --idx->tombs;
+    }
+    tags[b] = index_tag(idx, h);
+    idx->pos[b] = (uint16_t)pos;
+}
+
+/* bucket of the slot 'pos' */
+static uint32_t index_bucket(bmap *map, uint32_t hash, int pos)
+{
+    bmapindex *idx = map->index;
+    uint32_t h = index_mix(hash), b = h >> idx->shift;
+    bbyte tag = index_tag(idx, h), *tags = index_tags(idx);
+    while (tags[b] != tag || idx->pos[b] != pos) {
+        be_assert(tags[b] != TAG_EMPTY);
+        b = (b + 1) & idx->mask;
+    }
+    return b;
+}
+
+static bmapnode* index_find(bvm *vm, bmap *map, bvalue *key, uint32_t hash)
+{
+    bmapindex *idx = map->index;
+    uint32_t h = index_mix(hash), b = h >> idx->shift;
+    bbyte tag = index_tag(idx, h), *tags = index_tags(idx);
+    if (var_isnil(key)) {
+        return NULL;
+    }
+    while (tags[b] != TAG_EMPTY) {
+        if (tags[b] == tag) {
+            bmapnode *node = map->slots + idx->pos[b];
+            if (eqnode(vm, node, key)) {
+                return node;
+            }
+        }
+        b = (b + 1) & idx->mask;
+    }
+    return NULL;
+}
+
+/* allocate an empty index for 'size' slots, or none for small maps */
+static bmapindex* index_new(bvm *vm, int size)
+{
+    bmapindex *idx;
+    uint32_t n = 16, shift = 28;
+    if (size <= BE_MAP_SMALL_SIZE || size >= 0xFFFF) {
+        return NULL;
+    }
+    while (n < (uint32_t)size + size / 2) {
+        n <<= 1;
+        --shift;
+    }
+    idx = be_malloc(vm, index_datasize(n));
+    idx->mask = n - 1;
+    idx->shift = (uint8_t)shift;
+    idx->tombs = 0;
+    memset(index_tags(idx), TAG_EMPTY, n);
+    return idx;
+}
+
+static void index_delete(bvm *vm, bmap *map)
+{
+    if (map->index) {
+        be_free(vm, map->index, index_datasize(map->index->mask + 1));
+        map->index = NULL;
+    }
+}
+
+static void index_rebuild(bvm *vm, bmap *map)
+{
+    int i;
+    index_delete(vm, map);
+    map->index = index_new(vm, map->size);
+    if (map->index) {
+        for (i = 0; i < map->size; ++i) {
+            bmapnode *node = map->slots + i;
+            if (!isnil(node)) {
+                index_add(map, hashcode(key(node)), i);
+            }
+        }
+    }
+}
+#endif
+
 static bmapnode* findprev(bmap *map, bmapnode *list, bmapnode *slot)
 {
     int n, pos = pos(map, slot);
@@ -171,8 +275,18 @@ static bmapnode* insert(bvm *vm, bmap *map, bvalue *key, uint32_t hash)
             *new = *slot; /* copy to new slot */
             setkey(slot, key);
             next(slot) = LASTNODE;
+#if BE_USE_MAP_INDEX
+            if (map->index) { /* the old node moved */
+                map->index->pos[index_bucket(map, h, pos(map, slot))] = (uint16_t)pos(map, new);
+            }
+#endif
         }
     }
+#if BE_USE_MAP_INDEX
+    if (map->index) {
+        index_add(map, hash, pos(map, slot));
+    }
+#endif
     return slot;
 }
 
@@ -181,11 +295,16 @@ static bmapnode* find(bvm *vm, bmap *map, bvalue *key, uint32_t hash)
     if (map->size == 0) {   /* this situation happens only for solidified empty maps that are compacted */
         return NULL;
     }
+#if BE_USE_MAP_INDEX
+    if (map->index) {
+        return index_find(vm, map, key, hash);
+    }
+#endif
     bmapnode *slot = hash2slot(map, hash);
     if (isnil(slot)) {
         return NULL;
     }
-    while (!eqnode(vm, slot, key, hash)) {
+    while (!eqnode(vm, slot, key)) {
         int n = next(slot);
         if (n == LASTNODE) {
             return NULL;
@@ -204,6 +323,9 @@ static void resize(bvm *vm, bmap *map, int size)
     }
     oldsize = map->size;
     oldslots = map->slots;
+#if BE_USE_MAP_INDEX
+    bmapindex *index = index_new(vm, size); /* filled by insert() */
+#endif
     slots = be_malloc(vm, datasize(size));
     for (i = 0; i < size; ++i) {
         setnil(slots + i);
@@ -212,6 +334,10 @@ static void resize(bvm *vm, bmap *map, int size)
     map->size = size;
     map->slots = slots;
     map->lastfree = slots + size - 1;
+#if BE_USE_MAP_INDEX
+    index_delete(vm, map);
+    map->index = index;
+#endif
     /* rehash */
     for (i = 0; i < oldsize; ++i) {
         bmapnode *node = oldslots + i;
@@ -235,6 +361,9 @@ bmap* be_map_new(bvm *vm)
         map->size = 0;
         map->count = 0;
         map->slots = NULL;
+#if BE_USE_MAP_INDEX
+        map->index = NULL;
+#endif
         var_setmap(vm->top, map);
         be_incrtop(vm);
         resize(vm, map, 2);
@@ -245,6 +374,9 @@ bmap* be_map_new(bvm *vm)
 
 void be_map_delete(bvm *vm, bmap *map)
 {
+#if BE_USE_MAP_INDEX
+    index_delete(vm, map);
+#endif
     be_free(vm, map->slots, datasize(map->size));
     be_free(vm, map, sizeof(bmap));
 }
@@ -277,8 +409,19 @@ int be_map_remove(bvm *vm, bmap *map, bvalue *key)
     uint32_t hash = hashcode(key);
     bmapnode *slot = hash2slot(map, hash); /* main slot */
 
-    if (eqnode(vm, slot, key, hash)) { /* first node */
+    if (eqnode(vm, slot, key)) { /* first node */
         bmapnode *next = pos2slot(map, next(slot));
+#if BE_USE_MAP_INDEX
+        if (map->index) {
+            bmapindex *idx = map->index;
+            uint32_t b = index_bucket(map, hash, pos(map, slot));
+            index_tags(idx)[b] = TAG_REMOVED;
+            ++idx->tombs;
+            if (next) { /* the second node moves to the slot */
+                idx->pos[index_bucket(map, hashcode(key(next)), pos(map, next))] = (uint16_t)pos(map, slot);
+            }
+        }
+#endif
         if (next) { /* has next */
             *slot = *next; /* first: copy the second node to the slot */
             slot = next; /* second: set the second node to nil (empty) */
@@ -291,13 +434,20 @@ int be_map_remove(bvm *vm, bmap *map, bvalue *key)
             if (slot == NULL) { /* node not found */
                 return bfalse;
             }
-            if (eqnode(vm, slot, key, hash)) {
+            if (eqnode(vm, slot, key)) {
                 break;
             }
             prev = slot;
         }
         /* link the list */
         next(prev) = next(slot);
+#if BE_USE_MAP_INDEX
+        if (map->index) {
+            bmapindex *idx = map->index;
+            index_tags(idx)[index_bucket(map, hash, pos(map, slot))] = TAG_REMOVED;
+            ++idx->tombs;
+        }
+#endif
     }
     /* set to nil */
     setnil(slot);
@@ -306,6 +456,11 @@ int be_map_remove(bvm *vm, bmap *map, bvalue *key)
         map->lastfree = slot;
     }
     --map->count;
+#if BE_USE_MAP_INDEX
+    if (map->index && map->index->tombs > (int)(map->index->mask >> 2)) {
+        index_rebuild(vm, map);
+    }
+#endif
     return btrue;
 }
 
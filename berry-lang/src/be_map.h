@@ -21,6 +21,18 @@ typedef struct bmapnode {
     bvalue value;
 } bmapnode;
 
+#if BE_USE_MAP_INDEX
+/* open addressing index of the slots, for runtime maps larger than
+ * BE_MAP_SMALL_SIZE: each bucket holds a slot position and a tag byte
+ * taken from the key hash, the tags follow the positions */
+typedef struct bmapindex {
+    uint32_t mask;      /* number of buckets - 1 */
+    uint8_t shift;      /* 32 - log2(number of buckets) */
+    int tombs;          /* removed buckets, rebuilt when too many */
+    uint16_t pos[1];
+} bmapindex;
+#endif
+
 struct bmap {
     bcommon_header;
     bgcobject *gray; /* for gc gray list */
@@ -28,10 +40,17 @@ struct bmap {
     bmapnode *lastfree;
     int size;
     int count;
+#if BE_USE_MAP_INDEX
+    bmapindex *index; /* NULL for small and constant maps */
+#endif
 #ifdef __cplusplus
     BE_CONSTEXPR bmap(bmapnode *s, int n) :
         next(0), type(BE_MAP), marked(GC_CONST), gray(0),
-        slots(s), lastfree(0), size(n), count(n) {}
+        slots(s), lastfree(0), size(n), count(n)
+#if BE_USE_MAP_INDEX
+        , index(0)
+#endif
+        {}
 #endif
 };
 
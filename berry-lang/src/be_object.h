@@ -44,6 +44,7 @@
 #define BE_VA_STATICMETHOD      (1 << 2)    /* the function is a static method and has the class as implicit '_class' variable */
 #define BE_VA_SHARED_KTAB       (1 << 3)    /* the funciton has a shared consolidated ktab */
 #define BE_VA_NOCOMPACT         (1 << 4)    /* the funciton has a shared consolidated ktab */
+#define BE_VA_SHARED_CODE       (1 << 5)    /* the function code is in a bytecode buffer, not owned by the proto */
 #define array_count(a)   (sizeof(a) / sizeof((a)[0]))
 
 #define bcommon_header          \
@@ -0,0 +1,829 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#if !defined(_POSIX_C_SOURCE) && !defined(_WIN32)
+  #define _POSIX_C_SOURCE   200809L  /* sigaction in strict C99 */
+#endif
+#include "be_profiler.h"
+#include "be_vm.h"
+#include "be_class.h"
+#include "be_func.h"
+#include "be_map.h"
+#include "be_string.h"
+#include "be_vector.h"
+#include "be_mem.h"
+#include <string.h>
+#include <stdio.h>
+
+#if BE_USE_PROFILER
+
+/* Sampling profiler
+ *
+ * The VM calls `be_profiler_sample()` from its dispatch loop when
+ * `vm->profile_countdown` reaches 0: every `period` instructions, or
+ * at the next instruction after a SIGPROF timer tick on POSIX hosts.
+ * Each sample walks the call frames and records the Berry call stack
+ * as a sequence of (function, line) frames, native frames are skipped.
+ * Identical stacks are counted in a hash table, the function and line
+ * histograms are derived from it when reporting.
+ *
+ * Allocation tracking uses the same stacks: `be_realloc()` calls
+ * `be_profiler_alloc()` for each new or growing block, the stack gets
+ * a last frame with the type of the GC object being allocated, or raw
+ * data. Allocations are counted since the last mark, for a per frame
+ * report, and since tracking started.
+ *
+ * All the memory of the profiler is taken from the OS allocator, so
+ * that sampling never triggers a garbage collection. */
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__) && !defined(ESP_PLATFORM)
+  #define BE_PROFILER_TIMER     1
+  #include <signal.h>
+  #include <sys/time.h>
+#else
+  #define BE_PROFILER_TIMER     0
+#endif
+
+/* a frame is a function index in the high 16 bits and a line number */
+#define FRAME(func, line)       (((uint32_t)(func) << 16) | ((line) > 0xFFFF ? 0xFFFF : (uint32_t)(line)))
+#define FRAME_FUNC(frame)       ((frame) >> 16)
+#define FRAME_LINE(frame)       ((frame) & 0xFFFF)
+#define FUNC_TRUNCATED          0xFFFF  /* outer frames dropped from a deep stack */
+#define FUNC_TYPE               0xFFFE  /* allocated type, in place of the line */
+#define PROTO_REMOVED           ((const bproto *)1)
+
+typedef struct {
+    uint32_t hash;
+    uint32_t count;     /* samples or allocations, 0 for an empty slot */
+    uint32_t bytes;     /* allocated bytes */
+    uint32_t offset;    /* first frame in `frames` */
+    uint32_t depth;
+} bprofstack;
+
+/* distinct call stacks, frames are stored from the outermost */
+typedef struct {
+    bprofstack *slots;
+    uint32_t mask;      /* number of slots - 1 */
+    uint32_t used;
+    uint32_t *frames;
+    uint32_t nframes;
+    uint32_t sframes;
+} bprofstacks;
+
+typedef struct {
+    const bproto *proto;    /* NULL for an empty slot */
+    uint32_t func;
+} bprofproto;
+
+struct bprofiler {
+    int period;             /* instructions between samples, 0 on timer */
+    bbool running;
+    uint32_t samples;
+    uint32_t dropped;       /* samples lost for lack of memory */
+    bprofproto *protos;     /* function index of the sampled protos */
+    uint32_t pmask;
+    uint32_t pused;         /* including removed protos */
+    char (*names)[BE_PROFILER_NAME_SIZE]; /* function labels */
+    uint32_t nnames;
+    uint32_t snames;
+    bprofstacks stacks;
+    bbool tracking;         /* allocation tracking */
+    bbool busy;             /* building a report, its allocations are not tracked */
+    bprofstacks allocs;     /* allocations since the last mark */
+    bprofstacks allocs_total; /* allocations since tracking started */
+};
+
+#if BE_PROFILER_TIMER
+static bvm * volatile timer_vm; /* only one VM can own the timer */
+
+static void on_sigprof(int sig)
+{
+    (void)sig;
+    if (timer_vm) {
+        timer_vm->profile_countdown = 1; /* sample at the next instruction */
+    }
+}
+
+static void set_timer(int interval)
+{
+    struct itimerval it;
+    it.it_interval.tv_sec = interval / 1000000;
+    it.it_interval.tv_usec = interval % 1000000;
+    it.it_value = it.it_interval;
+    setitimer(ITIMER_PROF, &it, NULL);
+}
+#endif
+
+static uint32_t stack_hash(const uint32_t *frames, uint32_t depth)
+{
+    uint32_t hash = 2166136261u; /* FNV-1a */
+    while (depth--) {
+        hash = (hash ^ *frames++) * 16777619u;
+    }
+    return hash;
+}
+
+static bbool stacks_grow(bprofstacks *st)
+{
+    uint32_t i, size = st->slots ? (st->mask + 1) * 2 : 256;
+    bprofstack *slots = be_os_malloc(size * sizeof(bprofstack));
+    if (slots == NULL) {
+        return bfalse;
+    }
+    memset(slots, 0, size * sizeof(bprofstack));
+    if (st->slots) {
+        for (i = 0; i <= st->mask; ++i) {
+            if (st->slots[i].count) {
+                uint32_t j = st->slots[i].hash & (size - 1);
+                while (slots[j].count) {
+                    j = (j + 1) & (size - 1);
+                }
+                slots[j] = st->slots[i];
+            }
+        }
+        be_os_free(st->slots);
+    }
+    st->slots = slots;
+    st->mask = size - 1;
+    return btrue;
+}
+
+/* add `count` samples to a stack, returns false if out of memory */
+static bbool stacks_add(bprofstacks *st, const uint32_t *frames, uint32_t depth, uint32_t count, uint32_t bytes)
+{
+    uint32_t i, hash = stack_hash(frames, depth);
+    if (st->slots == NULL || (st->used + 1) * 4 > (st->mask + 1) * 3) {
+        if (!stacks_grow(st)) {
+            return bfalse;
+        }
+    }
+    for (i = hash & st->mask; st->slots[i].count; i = (i + 1) & st->mask) {
+        bprofstack *s = &st->slots[i];
+        if (s->hash == hash && s->depth == depth &&
+            !memcmp(st->frames + s->offset, frames, depth * sizeof(uint32_t))) {
+            s->count += count;
+            s->bytes += bytes;
+            return btrue;
+        }
+    }
+    if (st->nframes + depth > st->sframes) {
+        uint32_t size = st->sframes ? st->sframes * 2 : 1024;
+        uint32_t *p;
+        while (size < st->nframes + depth) {
+            size *= 2;
+        }
+        p = be_os_realloc(st->frames, size * sizeof(uint32_t));
+        if (p == NULL) {
+            return bfalse;
+        }
+        st->frames = p;
+        st->sframes = size;
+    }
+    memcpy(st->frames + st->nframes, frames, depth * sizeof(uint32_t));
+    st->slots[i].hash = hash;
+    st->slots[i].count = count;
+    st->slots[i].bytes = bytes;
+    st->slots[i].offset = st->nframes;
+    st->slots[i].depth = depth;
+    st->nframes += depth;
+    st->used++;
+    return btrue;
+}
+
+static void stacks_free(bprofstacks *st)
+{
+    be_os_free(st->slots);
+    be_os_free(st->frames);
+    memset(st, 0, sizeof(bprofstacks));
+}
+
+static uint32_t proto_hash(const bproto *proto)
+{
+    return (uint32_t)((uintptr_t)proto >> 3) * 2654435761u;
+}
+
+static bprofproto* proto_find(bprofiler *pf, const bproto *proto)
+{
+    if (pf->protos) {
+        uint32_t i = proto_hash(proto) & pf->pmask;
+        for (; pf->protos[i].proto; i = (i + 1) & pf->pmask) {
+            if (pf->protos[i].proto == proto) {
+                return &pf->protos[i];
+            }
+        }
+    }
+    return NULL;
+}
+
+static bbool protos_grow(bprofiler *pf)
+{
+    uint32_t i, size = pf->protos ? (pf->pmask + 1) * 2 : 64;
+    bprofproto *protos = be_os_malloc(size * sizeof(bprofproto));
+    if (protos == NULL) {
+        return bfalse;
+    }
+    memset(protos, 0, size * sizeof(bprofproto));
+    pf->pused = 0;
+    if (pf->protos) { /* removed protos are dropped */
+        for (i = 0; i <= pf->pmask; ++i) {
+            const bproto *proto = pf->protos[i].proto;
+            if (proto && proto != PROTO_REMOVED) {
+                uint32_t j = proto_hash(proto) & (size - 1);
+                while (protos[j].proto) {
+                    j = (j + 1) & (size - 1);
+                }
+                protos[j] = pf->protos[i];
+                pf->pused++;
+            }
+        }
+        be_os_free(pf->protos);
+    }
+    pf->protos = protos;
+    pf->pmask = size - 1;
+    return btrue;
+}
+
+/* class defining a method, searched from the class of the instance */
+static bclass* method_class(bclass *cl, const bproto *proto)
+{
+    for (; cl; cl = be_class_super(cl)) {
+        bmap *members = be_class_members(cl);
+        if (members) {
+            bmapnode *node;
+            bmapiter iter = be_map_iter();
+            while ((node = be_map_next(members, &iter)) != NULL) {
+                if (var_isclosure(&node->value) &&
+                    cast(bclosure*, var_toobj(&node->value))->proto == proto) {
+                    return cl;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+/* index of a function label, `Class.method` for methods */
+static int func_index(bprofiler *pf, const bproto *proto, bvalue *reg)
+{
+    char label[BE_PROFILER_NAME_SIZE];
+    uint32_t i;
+    bclass *cl = NULL;
+    if ((proto->varg & BE_VA_METHOD) && var_isinstance(reg)) {
+        cl = method_class(be_instance_class(cast(binstance*, var_toobj(reg))), proto);
+    }
+    if (cl) {
+        snprintf(label, sizeof(label), "%s.%s", str(be_class_name(cl)), str(proto->name));
+    } else {
+        snprintf(label, sizeof(label), "%s", str(proto->name));
+    }
+    for (i = 0; i < pf->nnames; ++i) { /* protos of the same name share their label */
+        if (!strcmp(pf->names[i], label)) {
+            return (int)i;
+        }
+    }
+    if (pf->nnames >= FUNC_TYPE) {
+        return -1;
+    }
+    if (pf->nnames >= pf->snames) {
+        uint32_t size = pf->snames ? pf->snames * 2 : 64;
+        void *names = be_os_realloc(pf->names, size * BE_PROFILER_NAME_SIZE);
+        if (names == NULL) {
+            return -1;
+        }
+        pf->names = names;
+        pf->snames = size;
+    }
+    memcpy(pf->names[pf->nnames], label, sizeof(label));
+    return (int)pf->nnames++;
+}
+
+static int proto_func(bprofiler *pf, const bproto *proto, bvalue *reg)
+{
+    bprofproto *p = proto_find(pf, proto);
+    int func;
+    if (p) {
+        return (int)p->func;
+    }
+    func = func_index(pf, proto, reg);
+    if (func >= 0) {
+        uint32_t i;
+        if (pf->protos == NULL || (pf->pused + 1) * 4 > (pf->pmask + 1) * 3) {
+            if (!protos_grow(pf)) {
+                return -1;
+            }
+        }
+        for (i = proto_hash(proto) & pf->pmask; pf->protos[i].proto; i = (i + 1) & pf->pmask);
+        pf->protos[i].proto = proto;
+        pf->protos[i].func = (uint32_t)func;
+        pf->pused++;
+    }
+    return func;
+}
+
+/* line of the instruction before `ip`, 0 if unknown */
+static int proto_line(const bproto *proto, const binstruction *ip)
+{
+#if BE_DEBUG_RUNTIME_INFO
+    if (proto->lineinfo && proto->nlineinfo && ip) {
+        blineinfo *it = proto->lineinfo;
+        blineinfo *end = it + proto->nlineinfo - 1;
+        int pc = cast_int(ip - proto->code - 1);
+        if (pc >= 0 && pc < proto->codesize) {
+            for (; it < end && pc > it->endpc; ++it);
+            return it->linenumber;
+        }
+    }
+#else
+    (void)proto; (void)ip;
+#endif
+    return 0;
+}
+
+/* Berry call stack from the outermost frame, `ip` is the instruction
+ * pointer of the top Berry frame, past the current instruction */
+static uint32_t collect_stack(bvm *vm, bprofiler *pf, uint32_t *frames, binstruction *ip)
+{
+    uint32_t i, depth = 0;
+    bcallframe *base = be_stack_base(&vm->callstack);
+    bcallframe *cf = be_stack_top(&vm->callstack);
+    bvalue *reg = vm->reg;
+    /* Native frames do not save `ip`, the `ip` of a Berry frame is
+     * saved in the next Berry frame above it. Each frame saves the
+     * base register of its caller. */
+    for (; cf >= base; --cf) {
+        if (var_isclosure(cf->func)) {
+            bproto *proto = cast(bclosure*, var_toobj(cf->func))->proto;
+            int func;
+            if (depth == BE_PROFILER_MAX_DEPTH - 2) { /* keep room for the allocated type */
+                frames[depth++] = FRAME(FUNC_TRUNCATED, 0);
+                break;
+            }
+            func = proto_func(pf, proto, reg);
+            if (func < 0) {
+                return (uint32_t)-1;
+            }
+            frames[depth++] = FRAME(func, proto_line(proto, ip));
+            ip = cf->ip;
+        }
+        reg = cf->reg;
+    }
+    for (i = 0; i < depth / 2; ++i) {
+        uint32_t frame = frames[i];
+        frames[i] = frames[depth - 1 - i];
+        frames[depth - 1 - i] = frame;
+    }
+    return depth;
+}
+
+void be_profiler_sample(bvm *vm)
+{
+    bprofiler *pf = vm->profiler;
+    uint32_t frames[BE_PROFILER_MAX_DEPTH];
+    uint32_t depth;
+    if (pf == NULL || !pf->running) {
+        return;
+    }
+    /* the current instruction is not fetched yet */
+    depth = collect_stack(vm, pf, frames, vm->ip + 1);
+    if (depth && depth != (uint32_t)-1 && stacks_add(&pf->stacks, frames, depth, 1, 0)) {
+        pf->samples++;
+    } else {
+        pf->dropped++;
+    }
+    if (pf->period) {
+        vm->profile_countdown = pf->period;
+    }
+}
+
+void be_profiler_alloc(bvm *vm, size_t size)
+{
+    bprofiler *pf = vm->profiler;
+    uint32_t frames[BE_PROFILER_MAX_DEPTH];
+    uint32_t depth;
+    int type = vm->profile_alloc_type;
+    vm->profile_alloc_type = 0;
+    if (!pf->tracking || pf->busy) {
+        return;
+    }
+    depth = collect_stack(vm, pf, frames, vm->ip);
+    if (depth == (uint32_t)-1) {
+        return;
+    }
+    frames[depth++] = FRAME(FUNC_TYPE, type);
+    stacks_add(&pf->allocs, frames, depth, 1, (uint32_t)size);
+    stacks_add(&pf->allocs_total, frames, depth, 1, (uint32_t)size);
+}
+
+void be_profiler_forget(bvm *vm, bproto *proto)
+{
+    bprofproto *p = proto_find(vm->profiler, proto);
+    if (p) { /* the address may be reused by a new proto */
+        p->proto = PROTO_REMOVED;
+    }
+}
+
+/* the profiler of the VM, created on first use */
+static bprofiler* get_profiler(bvm *vm)
+{
+    if (vm->profiler == NULL) {
+        bprofiler *pf = be_os_malloc(sizeof(bprofiler));
+        if (pf) {
+            memset(pf, 0, sizeof(bprofiler));
+            vm->profile_alloc_type = 0;
+            vm->profiler = pf;
+        }
+    }
+    return vm->profiler;
+}
+
+bbool be_profiler_start(bvm *vm, int period, bbool timer)
+{
+    bprofiler *pf;
+#if BE_PROFILER_TIMER
+    if (timer && timer_vm && timer_vm != vm) {
+        return bfalse;
+    }
+#else
+    if (timer) {
+        return bfalse;
+    }
+#endif
+    if (period <= 0) {
+        period = timer ? BE_PROFILER_INTERVAL : BE_PROFILER_PERIOD;
+    }
+    be_profiler_stop(vm);
+    pf = get_profiler(vm);
+    if (pf == NULL) {
+        return bfalse;
+    }
+    stacks_free(&pf->stacks);
+    pf->samples = pf->dropped = 0;
+    pf->running = btrue;
+#if BE_PROFILER_TIMER
+    if (timer) {
+        struct sigaction sa;
+        pf->period = 0;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = on_sigprof;
+        sa.sa_flags = SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGPROF, &sa, NULL);
+        timer_vm = vm;
+        set_timer(period);
+        return btrue;
+    }
+#endif
+    pf->period = period;
+    vm->profile_countdown = period;
+    return btrue;
+}
+
+int be_profiler_stop(bvm *vm)
+{
+    bprofiler *pf = vm->profiler;
+    if (pf == NULL) {
+        return 0;
+    }
+    if (pf->running) {
+#if BE_PROFILER_TIMER
+        if (pf->period == 0) {
+            set_timer(0);
+            signal(SIGPROF, SIG_IGN); /* a pending signal would terminate the process */
+            timer_vm = NULL;
+        }
+#endif
+        pf->running = bfalse;
+        vm->profile_countdown = 0;
+    }
+    return (int)pf->samples;
+}
+
+void be_profiler_delete(bvm *vm)
+{
+    bprofiler *pf = vm->profiler;
+    if (pf) {
+        be_profiler_stop(vm);
+        stacks_free(&pf->stacks);
+        stacks_free(&pf->allocs);
+        stacks_free(&pf->allocs_total);
+        be_os_free(pf->protos);
+        be_os_free(pf->names);
+        be_os_free(pf);
+        vm->profiler = NULL;
+    }
+}
+
+bbool be_profiler_track(bvm *vm, bbool on)
+{
+    bprofiler *pf = on ? get_profiler(vm) : vm->profiler;
+    if (pf) {
+        stacks_free(&pf->allocs);
+        if (on) {
+            stacks_free(&pf->allocs_total);
+        }
+        pf->tracking = on;
+        pf->busy = bfalse;
+    }
+    return pf != NULL;
+}
+
+/* text buffer for the reports */
+typedef struct {
+    char *s;
+    size_t len;
+    size_t size;
+    bbool error;
+} bprofbuf;
+
+static void buf_append(bprofbuf *buf, const char *s, size_t len)
+{
+    if (buf->len + len > buf->size) {
+        size_t size = buf->size ? buf->size * 2 : 1024;
+        char *p;
+        while (size < buf->len + len) {
+            size *= 2;
+        }
+        p = be_os_realloc(buf->s, size);
+        if (p == NULL) {
+            buf->error = btrue;
+            return;
+        }
+        buf->s = p;
+        buf->size = size;
+    }
+    memcpy(buf->s + buf->len, s, len);
+    buf->len += len;
+}
+
+static const char* type_name(uint32_t type)
+{
+    switch (type) {
+    case BE_STRING: return "string";
+    case BE_CLASS: return "class";
+    case BE_INSTANCE: return "instance";
+    case BE_PROTO: return "proto";
+    case BE_LIST: return "list";
+    case BE_MAP: return "map";
+    case BE_MODULE: return "module";
+    case BE_COMOBJ: return "comobj";
+    case BE_CLOSURE: return "closure";
+    case BE_NTVCLOS: return "ntvclos";
+    default: return "data"; /* buffers of strings, lists, maps, bytes... */
+    }
+}
+
+static void buf_frame(bprofiler *pf, bprofbuf *buf, uint32_t frame, bbool lines)
+{
+    uint32_t func = FRAME_FUNC(frame);
+    if (func == FUNC_TRUNCATED) {
+        buf_append(buf, "...", 3);
+    } else if (func == FUNC_TYPE) {
+        const char *name = type_name(FRAME_LINE(frame));
+        buf_append(buf, name, strlen(name));
+    } else {
+        const char *name = pf->names[func];
+        buf_append(buf, name, strlen(name));
+        if (lines && FRAME_LINE(frame)) {
+            char line[12];
+            buf_append(buf, line, snprintf(line, sizeof(line), ":%u", (unsigned)FRAME_LINE(frame)));
+        }
+    }
+}
+
+/* allocations made by a report are not tracked */
+static bprofiler* report_begin(bvm *vm)
+{
+    bprofiler *pf = vm->profiler;
+    if (pf) {
+        pf->busy = btrue;
+    }
+    return pf;
+}
+
+static void report_end(bprofiler *pf)
+{
+    if (pf) {
+        pf->busy = bfalse;
+    }
+}
+
+static void report_error(bvm *vm, bprofiler *pf)
+{
+    report_end(pf);
+    be_raise(vm, "memory_error", "not enough memory for the profiler report");
+}
+
+/* collapsed stacks: one line per stack, frames separated by `;` and
+ * followed by the number of samples or allocated bytes, the input of
+ * flamegraph.pl */
+void be_profiler_dump(bvm *vm, bbool lines, bbool allocs)
+{
+    bprofiler *pf = report_begin(vm);
+    bprofstacks merged = { 0 };
+    bprofstacks *st = pf ? (allocs ? &pf->allocs_total : &pf->stacks) : &merged;
+    bprofbuf buf = { 0 };
+    uint32_t i, k;
+    if (pf && !lines) { /* merge the stacks that only differ by their lines */
+        for (i = 0; i <= st->mask && st->slots; ++i) {
+            bprofstack *s = &st->slots[i];
+            uint32_t frames[BE_PROFILER_MAX_DEPTH];
+            for (k = 0; k < s->depth; ++k) {
+                uint32_t frame = st->frames[s->offset + k];
+                frames[k] = FRAME_FUNC(frame) == FUNC_TYPE ? frame : FRAME(FRAME_FUNC(frame), 0);
+            }
+            if (s->count && !stacks_add(&merged, frames, s->depth, s->count, s->bytes)) {
+                buf.error = btrue;
+            }
+        }
+        st = &merged;
+    }
+    for (i = 0; i <= st->mask && st->slots; ++i) {
+        bprofstack *s = &st->slots[i];
+        if (s->count) {
+            char count[16];
+            for (k = 0; k < s->depth; ++k) {
+                if (k) {
+                    buf_append(&buf, ";", 1);
+                }
+                buf_frame(pf, &buf, st->frames[s->offset + k], lines);
+            }
+            buf_append(&buf, count, snprintf(count, sizeof(count), " %u\n",
+                (unsigned)(allocs ? s->bytes : s->count)));
+        }
+    }
+    stacks_free(&merged);
+    if (buf.error) {
+        be_os_free(buf.s);
+        report_error(vm, pf);
+    }
+    be_pushnstring(vm, buf.s ? buf.s : "", buf.len);
+    be_os_free(buf.s);
+    report_end(pf);
+}
+
+static void map_insert_pair(bvm *vm, const char *key, size_t len, uint32_t a, uint32_t b)
+{
+    be_pushnstring(vm, key, len);
+    be_newobject(vm, "list");
+    be_pushint(vm, a);
+    be_data_push(vm, -2);
+    be_pop(vm, 1);
+    be_pushint(vm, b);
+    be_data_push(vm, -2);
+    be_pop(vm, 2);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+}
+
+/* map of function label to [self samples, total samples] */
+void be_profiler_functions(bvm *vm)
+{
+    bprofiler *pf = report_begin(vm);
+    uint32_t *counts = NULL;
+    uint32_t i, j, k;
+    if (pf && pf->nnames) {
+        counts = be_os_malloc(pf->nnames * 2 * sizeof(uint32_t));
+        if (counts == NULL) {
+            report_error(vm, pf);
+        }
+        memset(counts, 0, pf->nnames * 2 * sizeof(uint32_t));
+        for (i = 0; pf->stacks.slots && i <= pf->stacks.mask; ++i) {
+            bprofstack *s = &pf->stacks.slots[i];
+            const uint32_t *frames = pf->stacks.frames + s->offset;
+            if (s->count == 0) {
+                continue;
+            }
+            counts[FRAME_FUNC(frames[s->depth - 1]) * 2] += s->count;
+            for (k = 0; k < s->depth; ++k) { /* recursive calls count once */
+                uint32_t func = FRAME_FUNC(frames[k]);
+                for (j = 0; j < k && FRAME_FUNC(frames[j]) != func; ++j);
+                if (j == k && func != FUNC_TRUNCATED) {
+                    counts[func * 2 + 1] += s->count;
+                }
+            }
+        }
+    }
+    be_newobject(vm, "map");
+    for (i = 0; counts && i < pf->nnames; ++i) {
+        if (counts[i * 2 + 1]) {
+            map_insert_pair(vm, pf->names[i], strlen(pf->names[i]), counts[i * 2], counts[i * 2 + 1]);
+        }
+    }
+    be_pop(vm, 1);
+    be_os_free(counts);
+    report_end(pf);
+}
+
+/* map of `label:line` to the samples where the line was running */
+void be_profiler_lines(bvm *vm)
+{
+    bprofiler *pf = report_begin(vm);
+    bprofstacks leaves = { 0 };
+    uint32_t i;
+    if (pf) {
+        for (i = 0; pf->stacks.slots && i <= pf->stacks.mask; ++i) {
+            bprofstack *s = &pf->stacks.slots[i];
+            if (s->count) {
+                const uint32_t *leaf = pf->stacks.frames + s->offset + s->depth - 1;
+                if (!stacks_add(&leaves, leaf, 1, s->count, 0)) {
+                    stacks_free(&leaves);
+                    report_error(vm, pf);
+                }
+            }
+        }
+    }
+    be_newobject(vm, "map");
+    for (i = 0; leaves.slots && i <= leaves.mask; ++i) {
+        bprofstack *s = &leaves.slots[i];
+        if (s->count) {
+            bprofbuf buf = { 0 };
+            buf_frame(pf, &buf, leaves.frames[s->offset], btrue);
+            if (!buf.error) {
+                be_pushnstring(vm, buf.s, buf.len);
+                be_pushint(vm, s->count);
+                be_data_insert(vm, -3);
+                be_pop(vm, 2);
+            }
+            be_os_free(buf.s);
+        }
+    }
+    be_pop(vm, 1);
+    stacks_free(&leaves);
+    report_end(pf);
+}
+
+/* map of `label:line type` to [allocations, bytes], where the line is
+ * the innermost Berry frame, or `<native>` outside of Berry code */
+void be_profiler_allocs(bvm *vm, bbool cumulative)
+{
+    bprofiler *pf = report_begin(vm);
+    bprofstacks sites = { 0 };
+    uint32_t i;
+    if (pf) {
+        bprofstacks *st = cumulative ? &pf->allocs_total : &pf->allocs;
+        for (i = 0; st->slots && i <= st->mask; ++i) {
+            bprofstack *s = &st->slots[i];
+            if (s->count) {
+                uint32_t n = s->depth > 1 ? 2 : 1;
+                const uint32_t *site = st->frames + s->offset + s->depth - n;
+                if (!stacks_add(&sites, site, n, s->count, s->bytes)) {
+                    stacks_free(&sites);
+                    report_error(vm, pf);
+                }
+            }
+        }
+    }
+    be_newobject(vm, "map");
+    for (i = 0; sites.slots && i <= sites.mask; ++i) {
+        bprofstack *s = &sites.slots[i];
+        if (s->count) {
+            bprofbuf buf = { 0 };
+            const uint32_t *site = sites.frames + s->offset;
+            if (s->depth > 1) {
+                buf_frame(pf, &buf, *site++, btrue);
+            } else {
+                buf_append(&buf, "<native>", 8);
+            }
+            buf_append(&buf, " ", 1);
+            buf_frame(pf, &buf, *site, btrue);
+            if (!buf.error) {
+                map_insert_pair(vm, buf.s, buf.len, s->count, s->bytes);
+            }
+            be_os_free(buf.s);
+        }
+    }
+    be_pop(vm, 1);
+    stacks_free(&sites);
+    report_end(pf);
+}
+
+/* [allocations, bytes] since the last mark, then starts a new frame */
+void be_profiler_mark(bvm *vm)
+{
+    bprofiler *pf = report_begin(vm);
+    uint32_t i, count = 0, bytes = 0;
+    if (pf) {
+        bprofstacks *st = &pf->allocs;
+        for (i = 0; st->slots && i <= st->mask; ++i) {
+            count += st->slots[i].count;
+            bytes += st->slots[i].bytes;
+        }
+    }
+    be_newobject(vm, "list");
+    be_pushint(vm, count);
+    be_data_push(vm, -2);
+    be_pop(vm, 1);
+    be_pushint(vm, bytes);
+    be_data_push(vm, -2);
+    be_pop(vm, 2);
+    if (pf) {
+        stacks_free(&pf->allocs);
+    }
+    report_end(pf);
+}
+
+#endif /* BE_USE_PROFILER */
@@ -0,0 +1,41 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#ifndef BE_PROFILER_H
+#define BE_PROFILER_H
+
+#include "be_object.h"
+
+#if BE_USE_PROFILER
+
+#define BE_PROFILER_PERIOD          997     /* default instructions between samples */
+#define BE_PROFILER_INTERVAL        1000    /* default timer interval in microseconds */
+#define BE_PROFILER_MAX_DEPTH       64      /* innermost frames kept in a sample */
+#define BE_PROFILER_NAME_SIZE       64      /* maximum size of a function label */
+
+typedef struct bprofiler bprofiler;
+
+bbool be_profiler_start(bvm *vm, int period, bbool timer);
+int be_profiler_stop(bvm *vm);
+void be_profiler_sample(bvm *vm);
+void be_profiler_forget(bvm *vm, bproto *proto);
+void be_profiler_delete(bvm *vm);
+
+/* allocation tracking */
+bbool be_profiler_track(bvm *vm, bbool on);
+void be_profiler_alloc(bvm *vm, size_t size);
+
+/* reports, pushed on the top of the stack */
+void be_profiler_dump(bvm *vm, bbool lines, bbool allocs);
+void be_profiler_functions(bvm *vm);
+void be_profiler_lines(bvm *vm);
+void be_profiler_allocs(bvm *vm, bbool cumulative);
+void be_profiler_mark(bvm *vm);
+
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+/********************************************************************
+** Sampling profiler of the Berry VM
+**
+** `start([period [, timer]])` clears the samples and starts sampling,
+** every `period` instructions (default 997) or, with `timer` true,
+** every `period` microseconds of CPU time (default 1000, POSIX only).
+** Returns false if the profiler could not be started.
+** `stop()` stops sampling and returns the number of samples.
+** `dump([lines [, allocs]])` returns the samples as collapsed stacks,
+** one line per call stack `outer;inner count`, for flamegraph.pl or
+** speedscope. With `lines` true, frames are `function:line`. With
+** `allocs` true, the stacks are the tracked allocations, weighted by
+** bytes and ending with the allocated type.
+** `functions()` returns a map of function to [self, total] samples.
+** `lines()` returns a map of `function:line` to self samples.
+**
+** `track(on)` starts or stops tracking allocations, starting clears
+** the allocations. Returns false if the tracking could not be started.
+** `allocs([cumulative])` returns a map of `function:line type` to
+** [allocations, bytes], since the last `mark()` or, with `cumulative`
+** true, since tracking started. The type is the GC object type, or
+** `data` for buffers (string contents, list and map storage, bytes).
+** `mark()` returns [allocations, bytes] since the last mark and starts
+** a new frame.
+**
+** Methods are reported as `Class.method`. Line numbers need
+** BE_DEBUG_RUNTIME_INFO.
+**
+** To use: `import profiler`
+********************************************************************/
+#include "be_object.h"
+#include "be_profiler.h"
+
+#if BE_USE_PROFILER
+
+static int m_start(bvm *vm)
+{
+    int argc = be_top(vm);
+    int period = (argc >= 1 && be_isint(vm, 1)) ? be_toint(vm, 1) : 0;
+    bbool timer = argc >= 2 && be_tobool(vm, 2);
+    be_pushbool(vm, be_profiler_start(vm, period, timer));
+    be_return(vm);
+}
+
+static int m_stop(bvm *vm)
+{
+    be_pushint(vm, be_profiler_stop(vm));
+    be_return(vm);
+}
+
+static int m_dump(bvm *vm)
+{
+    int argc = be_top(vm);
+    be_profiler_dump(vm, argc >= 1 && be_tobool(vm, 1), argc >= 2 && be_tobool(vm, 2));
+    be_return(vm);
+}
+
+static int m_functions(bvm *vm)
+{
+    be_profiler_functions(vm);
+    be_return(vm);
+}
+
+static int m_lines(bvm *vm)
+{
+    be_profiler_lines(vm);
+    be_return(vm);
+}
+
+static int m_track(bvm *vm)
+{
+    be_pushbool(vm, be_profiler_track(vm, be_top(vm) < 1 || be_tobool(vm, 1)));
+    be_return(vm);
+}
+
+static int m_allocs(bvm *vm)
+{
+    be_profiler_allocs(vm, be_top(vm) >= 1 && be_tobool(vm, 1));
+    be_return(vm);
+}
+
+static int m_mark(bvm *vm)
+{
+    be_profiler_mark(vm);
+    be_return(vm);
+}
+
+#if !BE_USE_PRECOMPILED_OBJECT
+be_native_module_attr_table(profiler) {
+    be_native_module_function("start", m_start),
+    be_native_module_function("stop", m_stop),
+    be_native_module_function("dump", m_dump),
+    be_native_module_function("functions", m_functions),
+    be_native_module_function("lines", m_lines),
+    be_native_module_function("track", m_track),
+    be_native_module_function("allocs", m_allocs),
+    be_native_module_function("mark", m_mark)
+};
+
+be_define_native_module(profiler, NULL);
+#else
+/* @const_object_info_begin
+module profiler (scope: global, depend: BE_USE_PROFILER) {
+    start, func(m_start)
+    stop, func(m_stop)
+    dump, func(m_dump)
+    functions, func(m_functions)
+    lines, func(m_lines)
+    track, func(m_track)
+    allocs, func(m_allocs)
+    mark, func(m_mark)
+}
+@const_object_info_end */
+#include "../generate/be_fixed_profiler.h"
+#endif
+
+#endif /* BE_USE_PROFILER */
@@ -339,7 +339,7 @@ static void m_solidify_proto(bvm *vm, bbool str_literal, const bproto *pr, const
 
     logfmt("%*s%d,                          /* nstack */\n", indent, "", pr->nstack);
     logfmt("%*s%d,                          /* argc */\n", indent, "", pr->argc);
-    logfmt("%*s%d,                          /* varg */\n", indent, "", pr->varg);
+    logfmt("%*s%d,                          /* varg */\n", indent, "", pr->varg & ~BE_VA_SHARED_CODE);
     logfmt("%*s%d,                          /* has upvals */\n", indent, "", (pr->nupvals > 0) ? 1 : 0);
 
     if (pr->nupvals > 0) {
@@ -625,7 +625,7 @@ static void m_compact_class(bvm *vm, bbool str_literal, const bclass *cla, void*
                 bclosure *cl = var_toobj(&node->value);
                 bproto *pr = cl->proto;
 
-                if ((gc_isconst(cl)) || (pr->varg & BE_VA_SHARED_KTAB) || (pr->varg & BE_VA_NOCOMPACT)) { continue; }
+                if ((gc_isconst(cl)) || (pr->varg & (BE_VA_SHARED_KTAB | BE_VA_NOCOMPACT | BE_VA_SHARED_CODE))) { continue; }
 
                 // iterate on each bvalue in ktab
                 for (int i = 0; i < pr->nconst; i++) {
@@ -667,7 +667,7 @@ static void m_compact_class(bvm *vm, bbool str_literal, const bclass *cla, void*
                 bclosure *cl = var_toobj(&node->value);
                 bproto *pr = cl->proto;
 
-                if ((gc_isconst(cl)) || (pr->varg & BE_VA_SHARED_KTAB) || (pr->varg & BE_VA_NOCOMPACT)) { continue; }
+                if ((gc_isconst(cl)) || (pr->varg & (BE_VA_SHARED_KTAB | BE_VA_NOCOMPACT | BE_VA_SHARED_CODE))) { continue; }
 
                 uint8_t mapping_array[MAX_KTAB_SIZE];
                 // iterate in proto ktab to get the index in the global ktab
@@ -16,11 +16,19 @@
 #define lstr(_s)    cast(char*, cast(blstring*, _s) + 1)
 #define cstr(_s)    (cast(bcstring*, _s)->s)
 
+/* ex-mark of the strings of the constant string table, they are never
+ * duplicated at runtime */
+#define STR_UNIQUE      0x01
+
+/* short strings created at runtime and the ones of the constant string
+ * table are unique, other constant strings may duplicate them */
+#define isunique(_s) (!gc_isconst(_s) || (gc_exmark(_s) & STR_UNIQUE))
+
 #define be_define_const_str(_name, _s, _hash, _extra, _len, _next) \
     BERRY_LOCAL const bcstring be_const_str_##_name = {            \
         .next = (bgcobject *)_next,                                \
         .type = BE_STRING,                                         \
-        .marked = GC_CONST,                                        \
+        .marked = GC_CONST | (STR_UNIQUE << 4),                    \
         .extra = _extra,                                           \
         .slen = _len,                                              \
         .hash = _hash,                                             \
@@ -64,23 +72,19 @@ int be_eqstr(bstring *s1, bstring *s2)
     if (slen == 255) {  /* s2->slen is also 255 */
         blstring *ls1 = cast(blstring*, s1);
         blstring *ls2 = cast(blstring*, s2);
+#if BE_USE_STR_HASH_CACHE
+        if (ls1->hash && ls2->hash && ls1->hash != ls2->hash) {
+            return 0; /* both hashes are known and differ */
+        }
+#endif
         return ls1->llen == ls2->llen && !strcmp(lstr(ls1), lstr(ls2));
     }
-    /* const short strings */
-    if (gc_isconst(s1) || gc_isconst(s2)) { /* one of the two string is short const */
-        uint32_t hash1 = cast(bcstring*, s1)->hash;
-        uint32_t hash2 = cast(bcstring*, s2)->hash;
-        if (hash1 && hash2 && hash1 != hash2) {
-            return 0; /* if hash differ, since we know both are non-null */
-        }
-        /* if hash are equals, there might be a chance that they are different */
-        /* This can happen with solidified code that a same string is present more than once */
-        /* so just considering that two strings with the same hash must be same pointer, this is no more true */
-        return !strcmp(str(s1), str(s2));
+    /* unique short strings can't be equal without having the same pointer */
+    if (isunique(s1) && isunique(s2)) {
+        return 0;
     }
-
-    /* if both strings are in-memory, they can't be equal without having the same pointer */
-    return 0;
+    /* constant strings outside of the string table, e.g. in solidified code */
+    return !strcmp(str(s1), str(s2));
 }
 
 static void resize(bvm *vm, int size)
@@ -232,6 +236,9 @@ bstring* be_newlongstr(bvm *vm, const char *str, size_t len)
     ls = cast(blstring*, s);
     s->extra = 0;
     ls->llen = cast_int(len);
+#if BE_USE_STR_HASH_CACHE
+    ls->hash = 0; /* the content may be written after */
+#endif
     if (str) { /* if the argument 'str' is NULL, we just allocate space */
         memcpy(cast(char *, lstr(s)), str, len);
     }
@@ -290,20 +297,26 @@ void be_gcstrtab(bvm *vm)
 
 uint32_t be_strhash(const bstring *s)
 {
-    if (gc_isconst(s) && (s->slen != 255)) {
+    if (gc_isconst(s)) {
         bcstring* cs = cast(bcstring*, s);
-        if (cs->hash) {  /* if hash is null we need to compute it */
+        if (s->slen != 255 && cs->hash) {  /* if hash is null we need to compute it */
             return cs->hash;
-        } else {
-            return str_hash(cstr(s), str_len(s));
         }
+        return str_hash(str(s), str_len(s));
     }
 #if BE_USE_STR_HASH_CACHE
     if (s->slen != 255) {
         return cast(bsstring*, s)->hash;
+    } else {
+        blstring *ls = cast(blstring*, s);
+        if (!ls->hash) { /* computed once, the string no longer changes */
+            ls->hash = str_hash(lstr(s), ls->llen);
+        }
+        return ls->hash;
     }
-#endif
+#else
     return str_hash(str(s), str_len(s));
+#endif
 }
 
 const char* be_str2cstr(const bstring *s)
@@ -23,12 +23,18 @@ typedef struct {
 typedef struct {
     bstring str;
     int llen;
+#if BE_USE_STR_HASH_CACHE
+    uint32_t hash;      /* 0 until computed */
+#endif
     /* char s[]; */
 } blstring;
 
 typedef struct {        /* const long string */
     bstring_header;
     int llen;
+#if BE_USE_STR_HASH_CACHE
+    uint32_t hash;      /* unused, same layout as blstring */
+#endif
     char s[];
 } bclstring;
 
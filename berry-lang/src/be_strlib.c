@@ -1135,8 +1135,137 @@ static int str_endswith(bvm *vm)
     be_return_nil(vm);
 }
 
+/* string.builder: appends pieces into a growable buffer, so building
+ * a long string doesn't copy the partial result at each step */
+typedef struct {
+    char *buf;
+    size_t len, cap;
+} strbuilder;
+
+static int sb_destroy(bvm *vm)
+{
+    strbuilder *sb = be_tocomptr(vm, 1);
+    if (sb) {
+        be_free(vm, sb->buf, sb->cap);
+        be_free(vm, sb, sizeof(strbuilder));
+    }
+    be_return_nil(vm);
+}
+
+static strbuilder* sb_get(bvm *vm)
+{
+    strbuilder *sb;
+    be_getmember(vm, 1, ".p");
+    sb = be_tocomptr(vm, -1);
+    be_pop(vm, 1);
+    if (sb == NULL) {
+        be_raise(vm, "value_error", "string builder not initialized");
+    }
+    return sb;
+}
+
+static void sb_write(bvm *vm, strbuilder *sb, const char *s, size_t len)
+{
+    if (sb->len + len > sb->cap) {
+        size_t cap = sb->cap ? sb->cap : 64;
+        while (cap < sb->len + len) {
+            cap <<= 1;
+        }
+        sb->buf = be_realloc(vm, sb->buf, sb->cap, cap);
+        sb->cap = cap;
+    }
+    memcpy(sb->buf + sb->len, s, len);
+    sb->len += len;
+}
+
+static int sb_init(bvm *vm)
+{
+    strbuilder *sb = be_malloc(vm, sizeof(strbuilder));
+    sb->buf = NULL;
+    sb->len = sb->cap = 0;
+    be_newcomobj(vm, sb, sb_destroy);
+    be_setmember(vm, 1, ".p");
+    be_pop(vm, 1);
+    be_return_nil(vm);
+}
+
+/* append(v...) -> self, values are converted with tostring() */
+static int sb_append(bvm *vm)
+{
+    int i, top = be_top(vm);
+    strbuilder *sb = sb_get(vm);
+    for (i = 2; i <= top; ++i) {
+        const char *s = be_tostring(vm, i);
+        sb_write(vm, sb, s, be_strlen(vm, i));
+    }
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
+/* appendf(format, args...) -> self, same as append(format(format, args...)) */
+static int sb_appendf(bvm *vm)
+{
+    int i, top = be_top(vm);
+    strbuilder *sb = sb_get(vm);
+    if (top < 2 || !be_isstring(vm, 2)) {
+        be_raise(vm, "type_error", "appendf() expects a format string");
+    }
+    be_pushntvfunction(vm, be_str_format);
+    for (i = 2; i <= top; ++i) {
+        be_pushvalue(vm, i);
+    }
+    be_call(vm, top - 1);
+    be_pop(vm, top - 1);
+    sb_write(vm, sb, be_tostring(vm, -1), be_strlen(vm, -1));
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
+static int sb_tostring(bvm *vm)
+{
+    strbuilder *sb = sb_get(vm);
+    be_pushnstring(vm, sb->buf ? sb->buf : "", sb->len);
+    be_return(vm);
+}
+
+static int sb_size(bvm *vm)
+{
+    be_pushint(vm, (bint)sb_get(vm)->len);
+    be_return(vm);
+}
+
+/* clear() -> self, the buffer is kept for reuse */
+static int sb_clear(bvm *vm)
+{
+    sb_get(vm)->len = 0;
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
 #if !BE_USE_PRECOMPILED_OBJECT
+/* init(m) -> m, adds the `builder` class when the module is first imported */
+static int str_init(bvm *vm)
+{
+    static const bnfuncinfo members[] = {
+        { ".p", NULL },
+        { "init", sb_init },
+        { "append", sb_append },
+        { "appendf", sb_appendf },
+        { "tostring", sb_tostring },
+        { "size", sb_size },
+        { "clear", sb_clear },
+        { "..", sb_append },
+        { NULL, NULL }
+    };
+    be_pushclass(vm, "string_builder", members);
+    be_setmember(vm, 1, "builder");
+    be_pop(vm, 1);
+    be_pushvalue(vm, 1);
+    be_return(vm);
+}
+
 be_native_module_attr_table(string) {
+    be_native_module_function("init", str_init),
     be_native_module_function("format", be_str_format),
     be_native_module_function("count", str_count),
     be_native_module_function("split", str_split),
@@ -1155,6 +1284,20 @@ be_native_module_attr_table(string) {
 
 be_define_native_module(string, NULL);
 #else
+/* @const_object_info_begin
+class be_class_string_builder (scope: global, name: string_builder) {
+    .p, var
+    init, func(sb_init)
+    append, func(sb_append)
+    appendf, func(sb_appendf)
+    tostring, func(sb_tostring)
+    size, func(sb_size)
+    clear, func(sb_clear)
+    .., func(sb_append)
+}
+@const_object_info_end */
+#include "../generate/be_fixed_be_class_string_builder.h"
+
 /* @const_object_info_begin
 module string (scope: global, depend: BE_USE_STRING_MODULE) {
     format, func(be_str_format)
@@ -1171,6 +1314,7 @@ module string (scope: global, depend: BE_USE_STRING_MODULE) {
     replace, func(str_replace)
     startswith, func(str_startswith)
     endswith, func(str_endswith)
+    builder, class(be_class_string_builder)
 }
 @const_object_info_end */
 #include "../generate/be_fixed_string.h"
@@ -40,6 +40,8 @@ int be_unlink(const char *filename);
 int be_dirfirst(bdirinfo *info, const char *path);
 int be_dirnext(bdirinfo *info);
 int be_dirclose(bdirinfo *info);
+void* be_fmap(const char *filename, size_t *size);
+void be_funmap(void *data, size_t size);
 
 #ifdef __cplusplus
 }
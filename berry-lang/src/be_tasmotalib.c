@@ -0,0 +1,798 @@
+/********************************************************************
+** Berry Tasmota core native helpers for the emulator
+**
+** Native versions of the fixed-point helpers of the `tasmota` object
+** emulated in `tasmota_env/tasmota_core.be`. They are called thousands
+** of times per frame by the animation framework.
+**
+** Results are bit-identical to the Berry implementations, which are
+** kept in `tasmota_core.be` as reference.
+**
+** To use: `import tasmota_ntv`
+********************************************************************/
+#include "berry.h"
+#include "be_object.h"
+#include "be_exec.h"
+#include <math.h>
+#include <string.h>
+
+#if BE_USE_SINGLE_FLOAT
+  #define mathfunc(func)        func##f
+#else
+  #define mathfunc(func)        func
+#endif
+
+/* same value as `math.pi` */
+#define SINE_PI           3.141592653589793238462643383279
+
+/* period of `sine_int()`, 2*pi is 32768 */
+#define SINE_PERIOD       32768
+#define SINE_QUARTER      (SINE_PERIOD / 4)
+
+/* input range where the quarter-wave table is used */
+#define SINE_DOMAIN_MIN   (-32768)
+#define SINE_DOMAIN_MAX   65535
+
+/* quarter-wave table, `int(math.sin(i / 16384.0 * math.pi) * 4096)` for i in 0..8192 */
+static const int16_t sine_quarter[SINE_QUARTER + 1] = {
+  0,0,1,2,3,3,4,5,6,7,7,8,9,10,10,11,
+  12,13,14,14,15,16,17,18,18,19,20,21,21,22,23,24,
+  25,25,26,27,28,29,29,30,31,32,32,33,34,35,36,36,
+  37,38,39,40,40,41,42,43,43,44,45,46,47,47,48,49,
+  50,51,51,52,53,54,54,55,56,57,58,58,59,60,61,62,
+  62,63,64,65,65,66,67,68,69,69,70,71,72,73,73,74,
+  75,76,76,77,78,79,80,80,81,82,83,84,84,85,86,87,
+  87,88,89,90,91,91,92,93,94,95,95,96,97,98,98,99,
+  100,101,102,102,103,104,105,106,106,107,108,109,109,110,111,112,
+  113,113,114,115,116,117,117,118,119,120,120,121,122,123,124,124,
+  125,126,127,127,128,129,130,131,131,132,133,134,135,135,136,137,
+  138,138,139,140,141,142,142,143,144,145,146,146,147,148,149,149,
+  150,151,152,153,153,154,155,156,157,157,158,159,160,160,161,162,
+  163,164,164,165,166,167,168,168,169,170,171,171,172,173,174,175,
+  175,176,177,178,179,179,180,181,182,182,183,184,185,186,186,187,
+  188,189,189,190,191,192,193,193,194,195,196,197,197,198,199,200,
+  200,201,202,203,204,204,205,206,207,208,208,209,210,211,211,212,
+  213,214,215,215,216,217,218,219,219,220,221,222,222,223,224,225,
+  226,226,227,228,229,230,230,231,232,233,233,234,235,236,237,237,
+  238,239,240,240,241,242,243,244,244,245,246,247,248,248,249,250,
+  251,251,252,253,254,255,255,256,257,258,259,259,260,261,262,262,
+  263,264,265,266,266,267,268,269,269,270,271,272,273,273,274,275,
+  276,277,277,278,279,280,280,281,282,283,284,284,285,286,287,288,
+  288,289,290,291,291,292,293,294,295,295,296,297,298,298,299,300,
+  301,302,302,303,304,305,306,306,307,308,309,309,310,311,312,313,
+  313,314,315,316,316,317,318,319,320,320,321,322,323,324,324,325,
+  326,327,327,328,329,330,331,331,332,333,334,334,335,336,337,338,
+  338,339,340,341,342,342,343,344,345,345,346,347,348,349,349,350,
+  351,352,352,353,354,355,356,356,357,358,359,360,360,361,362,363,
+  363,364,365,366,367,367,368,369,370,370,371,372,373,374,374,375,
+  376,377,378,378,379,380,381,381,382,383,384,385,385,386,387,388,
+  388,389,390,391,392,392,393,394,395,396,396,397,398,399,399,400,
+  401,402,403,403,404,405,406,406,407,408,409,410,410,411,412,413,
+  413,414,415,416,417,417,418,419,420,421,421,422,423,424,424,425,
+  426,427,428,428,429,430,431,431,432,433,434,435,435,436,437,438,
+  438,439,440,441,442,442,443,444,445,446,446,447,448,449,449,450,
+  451,452,453,453,454,455,456,456,457,458,459,460,460,461,462,463,
+  463,464,465,466,467,467,468,469,470,470,471,472,473,474,474,475,
+  476,477,478,478,479,480,481,481,482,483,484,485,485,486,487,488,
+  488,489,490,491,492,492,493,494,495,495,496,497,498,499,499,500,
+  501,502,502,503,504,505,506,506,507,508,509,509,510,511,512,513,
+  513,514,515,516,516,517,518,519,520,520,521,522,523,523,524,525,
+  526,527,527,528,529,530,531,531,532,533,534,534,535,536,537,538,
+  538,539,540,541,541,542,543,544,545,545,546,547,548,548,549,550,
+  551,552,552,553,554,555,555,556,557,558,559,559,560,561,562,562,
+  563,564,565,566,566,567,568,569,569,570,571,572,573,573,574,575,
+  576,576,577,578,579,580,580,581,582,583,583,584,585,586,587,587,
+  588,589,590,590,591,592,593,594,594,595,596,597,597,598,599,600,
+  601,601,602,603,604,604,605,606,607,607,608,609,610,611,611,612,
+  613,614,614,615,616,617,618,618,619,620,621,621,622,623,624,625,
+  625,626,627,628,628,629,630,631,632,632,633,634,635,635,636,637,
+  638,639,639,640,641,642,642,643,644,645,646,646,647,648,649,649,
+  650,651,652,653,653,654,655,656,656,657,658,659,659,660,661,662,
+  663,663,664,665,666,666,667,668,669,670,670,671,672,673,673,674,
+  675,676,677,677,678,679,680,680,681,682,683,684,684,685,686,687,
+  687,688,689,690,690,691,692,693,694,694,695,696,697,697,698,699,
+  700,701,701,702,703,704,704,705,706,707,707,708,709,710,711,711,
+  712,713,714,714,715,716,717,718,718,719,720,721,721,722,723,724,
+  725,725,726,727,728,728,729,730,731,731,732,733,734,735,735,736,
+  737,738,738,739,740,741,742,742,743,744,745,745,746,747,748,748,
+  749,750,751,752,752,753,754,755,755,756,757,758,758,759,760,761,
+  762,762,763,764,765,765,766,767,768,769,769,770,771,772,772,773,
+  774,775,775,776,777,778,779,779,780,781,782,782,783,784,785,785,
+  786,787,788,789,789,790,791,792,792,793,794,795,796,796,797,798,
+  799,799,800,801,802,802,803,804,805,806,806,807,808,809,809,810,
+  811,812,812,813,814,815,816,816,817,818,819,819,820,821,822,822,
+  823,824,825,826,826,827,828,829,829,830,831,832,832,833,834,835,
+  836,836,837,838,839,839,840,841,842,842,843,844,845,846,846,847,
+  848,849,849,850,851,852,852,853,854,855,856,856,857,858,859,859,
+  860,861,862,862,863,864,865,865,866,867,868,869,869,870,871,872,
+  872,873,874,875,875,876,877,878,879,879,880,881,882,882,883,884,
+  885,885,886,887,888,889,889,890,891,892,892,893,894,895,895,896,
+  897,898,898,899,900,901,902,902,903,904,905,905,906,907,908,908,
+  909,910,911,911,912,913,914,915,915,916,917,918,918,919,920,921,
+  921,922,923,924,925,925,926,927,928,928,929,930,931,931,932,933,
+  934,934,935,936,937,938,938,939,940,941,941,942,943,944,944,945,
+  946,947,947,948,949,950,950,951,952,953,954,954,955,956,957,957,
+  958,959,960,960,961,962,963,963,964,965,966,967,967,968,969,970,
+  970,971,972,973,973,974,975,976,976,977,978,979,980,980,981,982,
+  983,983,984,985,986,986,987,988,989,989,990,991,992,992,993,994,
+  995,996,996,997,998,999,999,1000,1001,1002,1002,1003,1004,1005,1005,1006,
+  1007,1008,1008,1009,1010,1011,1011,1012,1013,1014,1015,1015,1016,1017,1018,1018,
+  1019,1020,1021,1021,1022,1023,1024,1024,1025,1026,1027,1027,1028,1029,1030,1031,
+  1031,1032,1033,1034,1034,1035,1036,1037,1037,1038,1039,1040,1040,1041,1042,1043,
+  1043,1044,1045,1046,1046,1047,1048,1049,1050,1050,1051,1052,1053,1053,1054,1055,
+  1056,1056,1057,1058,1059,1059,1060,1061,1062,1062,1063,1064,1065,1065,1066,1067,
+  1068,1068,1069,1070,1071,1072,1072,1073,1074,1075,1075,1076,1077,1078,1078,1079,
+  1080,1081,1081,1082,1083,1084,1084,1085,1086,1087,1087,1088,1089,1090,1090,1091,
+  1092,1093,1093,1094,1095,1096,1096,1097,1098,1099,1100,1100,1101,1102,1103,1103,
+  1104,1105,1106,1106,1107,1108,1109,1109,1110,1111,1112,1112,1113,1114,1115,1115,
+  1116,1117,1118,1118,1119,1120,1121,1121,1122,1123,1124,1124,1125,1126,1127,1127,
+  1128,1129,1130,1131,1131,1132,1133,1134,1134,1135,1136,1137,1137,1138,1139,1140,
+  1140,1141,1142,1143,1143,1144,1145,1146,1146,1147,1148,1149,1149,1150,1151,1152,
+  1152,1153,1154,1155,1155,1156,1157,1158,1158,1159,1160,1161,1161,1162,1163,1164,
+  1164,1165,1166,1167,1167,1168,1169,1170,1170,1171,1172,1173,1173,1174,1175,1176,
+  1176,1177,1178,1179,1179,1180,1181,1182,1182,1183,1184,1185,1185,1186,1187,1188,
+  1189,1189,1190,1191,1192,1192,1193,1194,1195,1195,1196,1197,1198,1198,1199,1200,
+  1201,1201,1202,1203,1204,1204,1205,1206,1207,1207,1208,1209,1210,1210,1211,1212,
+  1213,1213,1214,1215,1216,1216,1217,1218,1219,1219,1220,1221,1222,1222,1223,1224,
+  1225,1225,1226,1227,1228,1228,1229,1230,1231,1231,1232,1233,1234,1234,1235,1236,
+  1237,1237,1238,1239,1240,1240,1241,1242,1243,1243,1244,1245,1245,1246,1247,1248,
+  1248,1249,1250,1251,1251,1252,1253,1254,1254,1255,1256,1257,1257,1258,1259,1260,
+  1260,1261,1262,1263,1263,1264,1265,1266,1266,1267,1268,1269,1269,1270,1271,1272,
+  1272,1273,1274,1275,1275,1276,1277,1278,1278,1279,1280,1281,1281,1282,1283,1284,
+  1284,1285,1286,1287,1287,1288,1289,1290,1290,1291,1292,1293,1293,1294,1295,1296,
+  1296,1297,1298,1299,1299,1300,1301,1301,1302,1303,1304,1304,1305,1306,1307,1307,
+  1308,1309,1310,1310,1311,1312,1313,1313,1314,1315,1316,1316,1317,1318,1319,1319,
+  1320,1321,1322,1322,1323,1324,1325,1325,1326,1327,1328,1328,1329,1330,1330,1331,
+  1332,1333,1333,1334,1335,1336,1336,1337,1338,1339,1339,1340,1341,1342,1342,1343,
+  1344,1345,1345,1346,1347,1348,1348,1349,1350,1351,1351,1352,1353,1353,1354,1355,
+  1356,1356,1357,1358,1359,1359,1360,1361,1362,1362,1363,1364,1365,1365,1366,1367,
+  1368,1368,1369,1370,1371,1371,1372,1373,1373,1374,1375,1376,1376,1377,1378,1379,
+  1379,1380,1381,1382,1382,1383,1384,1385,1385,1386,1387,1388,1388,1389,1390,1390,
+  1391,1392,1393,1393,1394,1395,1396,1396,1397,1398,1399,1399,1400,1401,1402,1402,
+  1403,1404,1405,1405,1406,1407,1407,1408,1409,1410,1410,1411,1412,1413,1413,1414,
+  1415,1416,1416,1417,1418,1419,1419,1420,1421,1421,1422,1423,1424,1424,1425,1426,
+  1427,1427,1428,1429,1430,1430,1431,1432,1433,1433,1434,1435,1435,1436,1437,1438,
+  1438,1439,1440,1441,1441,1442,1443,1444,1444,1445,1446,1446,1447,1448,1449,1449,
+  1450,1451,1452,1452,1453,1454,1455,1455,1456,1457,1457,1458,1459,1460,1460,1461,
+  1462,1463,1463,1464,1465,1466,1466,1467,1468,1468,1469,1470,1471,1471,1472,1473,
+  1474,1474,1475,1476,1477,1477,1478,1479,1479,1480,1481,1482,1482,1483,1484,1485,
+  1485,1486,1487,1488,1488,1489,1490,1490,1491,1492,1493,1493,1494,1495,1496,1496,
+  1497,1498,1499,1499,1500,1501,1501,1502,1503,1504,1504,1505,1506,1507,1507,1508,
+  1509,1509,1510,1511,1512,1512,1513,1514,1515,1515,1516,1517,1517,1518,1519,1520,
+  1520,1521,1522,1523,1523,1524,1525,1526,1526,1527,1528,1528,1529,1530,1531,1531,
+  1532,1533,1534,1534,1535,1536,1536,1537,1538,1539,1539,1540,1541,1542,1542,1543,
+  1544,1544,1545,1546,1547,1547,1548,1549,1550,1550,1551,1552,1552,1553,1554,1555,
+  1555,1556,1557,1558,1558,1559,1560,1560,1561,1562,1563,1563,1564,1565,1566,1566,
+  1567,1568,1568,1569,1570,1571,1571,1572,1573,1573,1574,1575,1576,1576,1577,1578,
+  1579,1579,1580,1581,1581,1582,1583,1584,1584,1585,1586,1587,1587,1588,1589,1589,
+  1590,1591,1592,1592,1593,1594,1595,1595,1596,1597,1597,1598,1599,1600,1600,1601,
+  1602,1602,1603,1604,1605,1605,1606,1607,1608,1608,1609,1610,1610,1611,1612,1613,
+  1613,1614,1615,1615,1616,1617,1618,1618,1619,1620,1621,1621,1622,1623,1623,1624,
+  1625,1626,1626,1627,1628,1628,1629,1630,1631,1631,1632,1633,1633,1634,1635,1636,
+  1636,1637,1638,1639,1639,1640,1641,1641,1642,1643,1644,1644,1645,1646,1646,1647,
+  1648,1649,1649,1650,1651,1651,1652,1653,1654,1654,1655,1656,1656,1657,1658,1659,
+  1659,1660,1661,1662,1662,1663,1664,1664,1665,1666,1667,1667,1668,1669,1669,1670,
+  1671,1672,1672,1673,1674,1674,1675,1676,1677,1677,1678,1679,1679,1680,1681,1682,
+  1682,1683,1684,1684,1685,1686,1687,1687,1688,1689,1689,1690,1691,1692,1692,1693,
+  1694,1694,1695,1696,1697,1697,1698,1699,1699,1700,1701,1702,1702,1703,1704,1704,
+  1705,1706,1707,1707,1708,1709,1709,1710,1711,1712,1712,1713,1714,1714,1715,1716,
+  1717,1717,1718,1719,1719,1720,1721,1722,1722,1723,1724,1724,1725,1726,1727,1727,
+  1728,1729,1729,1730,1731,1732,1732,1733,1734,1734,1735,1736,1737,1737,1738,1739,
+  1739,1740,1741,1742,1742,1743,1744,1744,1745,1746,1747,1747,1748,1749,1749,1750,
+  1751,1751,1752,1753,1754,1754,1755,1756,1756,1757,1758,1759,1759,1760,1761,1761,
+  1762,1763,1764,1764,1765,1766,1766,1767,1768,1768,1769,1770,1771,1771,1772,1773,
+  1773,1774,1775,1776,1776,1777,1778,1778,1779,1780,1781,1781,1782,1783,1783,1784,
+  1785,1785,1786,1787,1788,1788,1789,1790,1790,1791,1792,1793,1793,1794,1795,1795,
+  1796,1797,1797,1798,1799,1800,1800,1801,1802,1802,1803,1804,1805,1805,1806,1807,
+  1807,1808,1809,1809,1810,1811,1812,1812,1813,1814,1814,1815,1816,1817,1817,1818,
+  1819,1819,1820,1821,1821,1822,1823,1824,1824,1825,1826,1826,1827,1828,1828,1829,
+  1830,1831,1831,1832,1833,1833,1834,1835,1835,1836,1837,1838,1838,1839,1840,1840,
+  1841,1842,1843,1843,1844,1845,1845,1846,1847,1847,1848,1849,1850,1850,1851,1852,
+  1852,1853,1854,1854,1855,1856,1857,1857,1858,1859,1859,1860,1861,1861,1862,1863,
+  1864,1864,1865,1866,1866,1867,1868,1868,1869,1870,1871,1871,1872,1873,1873,1874,
+  1875,1875,1876,1877,1877,1878,1879,1880,1880,1881,1882,1882,1883,1884,1884,1885,
+  1886,1887,1887,1888,1889,1889,1890,1891,1891,1892,1893,1894,1894,1895,1896,1896,
+  1897,1898,1898,1899,1900,1900,1901,1902,1903,1903,1904,1905,1905,1906,1907,1907,
+  1908,1909,1910,1910,1911,1912,1912,1913,1914,1914,1915,1916,1916,1917,1918,1919,
+  1919,1920,1921,1921,1922,1923,1923,1924,1925,1925,1926,1927,1928,1928,1929,1930,
+  1930,1931,1932,1932,1933,1934,1934,1935,1936,1937,1937,1938,1939,1939,1940,1941,
+  1941,1942,1943,1943,1944,1945,1946,1946,1947,1948,1948,1949,1950,1950,1951,1952,
+  1952,1953,1954,1955,1955,1956,1957,1957,1958,1959,1959,1960,1961,1961,1962,1963,
+  1964,1964,1965,1966,1966,1967,1968,1968,1969,1970,1970,1971,1972,1972,1973,1974,
+  1975,1975,1976,1977,1977,1978,1979,1979,1980,1981,1981,1982,1983,1983,1984,1985,
+  1986,1986,1987,1988,1988,1989,1990,1990,1991,1992,1992,1993,1994,1994,1995,1996,
+  1997,1997,1998,1999,1999,2000,2001,2001,2002,2003,2003,2004,2005,2005,2006,2007,
+  2007,2008,2009,2010,2010,2011,2012,2012,2013,2014,2014,2015,2016,2016,2017,2018,
+  2018,2019,2020,2020,2021,2022,2023,2023,2024,2025,2025,2026,2027,2027,2028,2029,
+  2029,2030,2031,2031,2032,2033,2033,2034,2035,2035,2036,2037,2038,2038,2039,2040,
+  2040,2041,2042,2042,2043,2044,2044,2045,2046,2046,2047,2048,2048,2049,2050,2050,
+  2051,2052,2052,2053,2054,2055,2055,2056,2057,2057,2058,2059,2059,2060,2061,2061,
+  2062,2063,2063,2064,2065,2065,2066,2067,2067,2068,2069,2069,2070,2071,2071,2072,
+  2073,2074,2074,2075,2076,2076,2077,2078,2078,2079,2080,2080,2081,2082,2082,2083,
+  2084,2084,2085,2086,2086,2087,2088,2088,2089,2090,2090,2091,2092,2092,2093,2094,
+  2094,2095,2096,2097,2097,2098,2099,2099,2100,2101,2101,2102,2103,2103,2104,2105,
+  2105,2106,2107,2107,2108,2109,2109,2110,2111,2111,2112,2113,2113,2114,2115,2115,
+  2116,2117,2117,2118,2119,2119,2120,2121,2121,2122,2123,2123,2124,2125,2125,2126,
+  2127,2127,2128,2129,2129,2130,2131,2131,2132,2133,2133,2134,2135,2136,2136,2137,
+  2138,2138,2139,2140,2140,2141,2142,2142,2143,2144,2144,2145,2146,2146,2147,2148,
+  2148,2149,2150,2150,2151,2152,2152,2153,2154,2154,2155,2156,2156,2157,2158,2158,
+  2159,2160,2160,2161,2162,2162,2163,2164,2164,2165,2166,2166,2167,2168,2168,2169,
+  2170,2170,2171,2172,2172,2173,2174,2174,2175,2176,2176,2177,2178,2178,2179,2180,
+  2180,2181,2182,2182,2183,2184,2184,2185,2186,2186,2187,2188,2188,2189,2190,2190,
+  2191,2192,2192,2193,2194,2194,2195,2195,2196,2197,2197,2198,2199,2199,2200,2201,
+  2201,2202,2203,2203,2204,2205,2205,2206,2207,2207,2208,2209,2209,2210,2211,2211,
+  2212,2213,2213,2214,2215,2215,2216,2217,2217,2218,2219,2219,2220,2221,2221,2222,
+  2223,2223,2224,2225,2225,2226,2227,2227,2228,2229,2229,2230,2231,2231,2232,2232,
+  2233,2234,2234,2235,2236,2236,2237,2238,2238,2239,2240,2240,2241,2242,2242,2243,
+  2244,2244,2245,2246,2246,2247,2248,2248,2249,2250,2250,2251,2252,2252,2253,2254,
+  2254,2255,2255,2256,2257,2257,2258,2259,2259,2260,2261,2261,2262,2263,2263,2264,
+  2265,2265,2266,2267,2267,2268,2269,2269,2270,2271,2271,2272,2273,2273,2274,2274,
+  2275,2276,2276,2277,2278,2278,2279,2280,2280,2281,2282,2282,2283,2284,2284,2285,
+  2286,2286,2287,2288,2288,2289,2289,2290,2291,2291,2292,2293,2293,2294,2295,2295,
+  2296,2297,2297,2298,2299,2299,2300,2301,2301,2302,2302,2303,2304,2304,2305,2306,
+  2306,2307,2308,2308,2309,2310,2310,2311,2312,2312,2313,2313,2314,2315,2315,2316,
+  2317,2317,2318,2319,2319,2320,2321,2321,2322,2323,2323,2324,2325,2325,2326,2326,
+  2327,2328,2328,2329,2330,2330,2331,2332,2332,2333,2334,2334,2335,2335,2336,2337,
+  2337,2338,2339,2339,2340,2341,2341,2342,2343,2343,2344,2345,2345,2346,2346,2347,
+  2348,2348,2349,2350,2350,2351,2352,2352,2353,2354,2354,2355,2355,2356,2357,2357,
+  2358,2359,2359,2360,2361,2361,2362,2363,2363,2364,2364,2365,2366,2366,2367,2368,
+  2368,2369,2370,2370,2371,2371,2372,2373,2373,2374,2375,2375,2376,2377,2377,2378,
+  2379,2379,2380,2380,2381,2382,2382,2383,2384,2384,2385,2386,2386,2387,2387,2388,
+  2389,2389,2390,2391,2391,2392,2393,2393,2394,2394,2395,2396,2396,2397,2398,2398,
+  2399,2400,2400,2401,2401,2402,2403,2403,2404,2405,2405,2406,2407,2407,2408,2408,
+  2409,2410,2410,2411,2412,2412,2413,2414,2414,2415,2415,2416,2417,2417,2418,2419,
+  2419,2420,2421,2421,2422,2422,2423,2424,2424,2425,2426,2426,2427,2427,2428,2429,
+  2429,2430,2431,2431,2432,2433,2433,2434,2434,2435,2436,2436,2437,2438,2438,2439,
+  2439,2440,2441,2441,2442,2443,2443,2444,2445,2445,2446,2446,2447,2448,2448,2449,
+  2450,2450,2451,2451,2452,2453,2453,2454,2455,2455,2456,2456,2457,2458,2458,2459,
+  2460,2460,2461,2462,2462,2463,2463,2464,2465,2465,2466,2467,2467,2468,2468,2469,
+  2470,2470,2471,2472,2472,2473,2473,2474,2475,2475,2476,2477,2477,2478,2478,2479,
+  2480,2480,2481,2482,2482,2483,2483,2484,2485,2485,2486,2487,2487,2488,2488,2489,
+  2490,2490,2491,2492,2492,2493,2493,2494,2495,2495,2496,2497,2497,2498,2498,2499,
+  2500,2500,2501,2501,2502,2503,2503,2504,2505,2505,2506,2506,2507,2508,2508,2509,
+  2510,2510,2511,2511,2512,2513,2513,2514,2515,2515,2516,2516,2517,2518,2518,2519,
+  2519,2520,2521,2521,2522,2523,2523,2524,2524,2525,2526,2526,2527,2528,2528,2529,
+  2529,2530,2531,2531,2532,2532,2533,2534,2534,2535,2536,2536,2537,2537,2538,2539,
+  2539,2540,2540,2541,2542,2542,2543,2544,2544,2545,2545,2546,2547,2547,2548,2548,
+  2549,2550,2550,2551,2552,2552,2553,2553,2554,2555,2555,2556,2556,2557,2558,2558,
+  2559,2560,2560,2561,2561,2562,2563,2563,2564,2564,2565,2566,2566,2567,2568,2568,
+  2569,2569,2570,2571,2571,2572,2572,2573,2574,2574,2575,2575,2576,2577,2577,2578,
+  2578,2579,2580,2580,2581,2582,2582,2583,2583,2584,2585,2585,2586,2586,2587,2588,
+  2588,2589,2589,2590,2591,2591,2592,2593,2593,2594,2594,2595,2596,2596,2597,2597,
+  2598,2599,2599,2600,2600,2601,2602,2602,2603,2603,2604,2605,2605,2606,2606,2607,
+  2608,2608,2609,2609,2610,2611,2611,2612,2613,2613,2614,2614,2615,2616,2616,2617,
+  2617,2618,2619,2619,2620,2620,2621,2622,2622,2623,2623,2624,2625,2625,2626,2626,
+  2627,2628,2628,2629,2629,2630,2631,2631,2632,2632,2633,2634,2634,2635,2635,2636,
+  2637,2637,2638,2638,2639,2640,2640,2641,2641,2642,2643,2643,2644,2644,2645,2646,
+  2646,2647,2647,2648,2649,2649,2650,2650,2651,2652,2652,2653,2653,2654,2655,2655,
+  2656,2656,2657,2658,2658,2659,2659,2660,2661,2661,2662,2662,2663,2664,2664,2665,
+  2665,2666,2667,2667,2668,2668,2669,2670,2670,2671,2671,2672,2673,2673,2674,2674,
+  2675,2675,2676,2677,2677,2678,2678,2679,2680,2680,2681,2681,2682,2683,2683,2684,
+  2684,2685,2686,2686,2687,2687,2688,2689,2689,2690,2690,2691,2692,2692,2693,2693,
+  2694,2694,2695,2696,2696,2697,2697,2698,2699,2699,2700,2700,2701,2702,2702,2703,
+  2703,2704,2705,2705,2706,2706,2707,2707,2708,2709,2709,2710,2710,2711,2712,2712,
+  2713,2713,2714,2715,2715,2716,2716,2717,2717,2718,2719,2719,2720,2720,2721,2722,
+  2722,2723,2723,2724,2725,2725,2726,2726,2727,2727,2728,2729,2729,2730,2730,2731,
+  2732,2732,2733,2733,2734,2734,2735,2736,2736,2737,2737,2738,2739,2739,2740,2740,
+  2741,2741,2742,2743,2743,2744,2744,2745,2746,2746,2747,2747,2748,2748,2749,2750,
+  2750,2751,2751,2752,2753,2753,2754,2754,2755,2755,2756,2757,2757,2758,2758,2759,
+  2760,2760,2761,2761,2762,2762,2763,2764,2764,2765,2765,2766,2766,2767,2768,2768,
+  2769,2769,2770,2771,2771,2772,2772,2773,2773,2774,2775,2775,2776,2776,2777,2777,
+  2778,2779,2779,2780,2780,2781,2781,2782,2783,2783,2784,2784,2785,2786,2786,2787,
+  2787,2788,2788,2789,2790,2790,2791,2791,2792,2792,2793,2794,2794,2795,2795,2796,
+  2796,2797,2798,2798,2799,2799,2800,2800,2801,2802,2802,2803,2803,2804,2804,2805,
+  2806,2806,2807,2807,2808,2808,2809,2810,2810,2811,2811,2812,2812,2813,2814,2814,
+  2815,2815,2816,2816,2817,2818,2818,2819,2819,2820,2820,2821,2822,2822,2823,2823,
+  2824,2824,2825,2826,2826,2827,2827,2828,2828,2829,2830,2830,2831,2831,2832,2832,
+  2833,2834,2834,2835,2835,2836,2836,2837,2837,2838,2839,2839,2840,2840,2841,2841,
+  2842,2843,2843,2844,2844,2845,2845,2846,2847,2847,2848,2848,2849,2849,2850,2850,
+  2851,2852,2852,2853,2853,2854,2854,2855,2856,2856,2857,2857,2858,2858,2859,2859,
+  2860,2861,2861,2862,2862,2863,2863,2864,2865,2865,2866,2866,2867,2867,2868,2868,
+  2869,2870,2870,2871,2871,2872,2872,2873,2874,2874,2875,2875,2876,2876,2877,2877,
+  2878,2879,2879,2880,2880,2881,2881,2882,2882,2883,2884,2884,2885,2885,2886,2886,
+  2887,2887,2888,2889,2889,2890,2890,2891,2891,2892,2892,2893,2894,2894,2895,2895,
+  2896,2896,2897,2897,2898,2899,2899,2900,2900,2901,2901,2902,2902,2903,2904,2904,
+  2905,2905,2906,2906,2907,2907,2908,2909,2909,2910,2910,2911,2911,2912,2912,2913,
+  2914,2914,2915,2915,2916,2916,2917,2917,2918,2918,2919,2920,2920,2921,2921,2922,
+  2922,2923,2923,2924,2925,2925,2926,2926,2927,2927,2928,2928,2929,2929,2930,2931,
+  2931,2932,2932,2933,2933,2934,2934,2935,2936,2936,2937,2937,2938,2938,2939,2939,
+  2940,2940,2941,2942,2942,2943,2943,2944,2944,2945,2945,2946,2946,2947,2948,2948,
+  2949,2949,2950,2950,2951,2951,2952,2952,2953,2954,2954,2955,2955,2956,2956,2957,
+  2957,2958,2958,2959,2960,2960,2961,2961,2962,2962,2963,2963,2964,2964,2965,2965,
+  2966,2967,2967,2968,2968,2969,2969,2970,2970,2971,2971,2972,2973,2973,2974,2974,
+  2975,2975,2976,2976,2977,2977,2978,2978,2979,2980,2980,2981,2981,2982,2982,2983,
+  2983,2984,2984,2985,2985,2986,2987,2987,2988,2988,2989,2989,2990,2990,2991,2991,
+  2992,2992,2993,2993,2994,2995,2995,2996,2996,2997,2997,2998,2998,2999,2999,3000,
+  3000,3001,3002,3002,3003,3003,3004,3004,3005,3005,3006,3006,3007,3007,3008,3008,
+  3009,3010,3010,3011,3011,3012,3012,3013,3013,3014,3014,3015,3015,3016,3016,3017,
+  3018,3018,3019,3019,3020,3020,3021,3021,3022,3022,3023,3023,3024,3024,3025,3025,
+  3026,3027,3027,3028,3028,3029,3029,3030,3030,3031,3031,3032,3032,3033,3033,3034,
+  3034,3035,3035,3036,3037,3037,3038,3038,3039,3039,3040,3040,3041,3041,3042,3042,
+  3043,3043,3044,3044,3045,3045,3046,3047,3047,3048,3048,3049,3049,3050,3050,3051,
+  3051,3052,3052,3053,3053,3054,3054,3055,3055,3056,3056,3057,3058,3058,3059,3059,
+  3060,3060,3061,3061,3062,3062,3063,3063,3064,3064,3065,3065,3066,3066,3067,3067,
+  3068,3068,3069,3070,3070,3071,3071,3072,3072,3073,3073,3074,3074,3075,3075,3076,
+  3076,3077,3077,3078,3078,3079,3079,3080,3080,3081,3081,3082,3082,3083,3084,3084,
+  3085,3085,3086,3086,3087,3087,3088,3088,3089,3089,3090,3090,3091,3091,3092,3092,
+  3093,3093,3094,3094,3095,3095,3096,3096,3097,3097,3098,3098,3099,3099,3100,3101,
+  3101,3102,3102,3103,3103,3104,3104,3105,3105,3106,3106,3107,3107,3108,3108,3109,
+  3109,3110,3110,3111,3111,3112,3112,3113,3113,3114,3114,3115,3115,3116,3116,3117,
+  3117,3118,3118,3119,3119,3120,3120,3121,3121,3122,3122,3123,3123,3124,3125,3125,
+  3126,3126,3127,3127,3128,3128,3129,3129,3130,3130,3131,3131,3132,3132,3133,3133,
+  3134,3134,3135,3135,3136,3136,3137,3137,3138,3138,3139,3139,3140,3140,3141,3141,
+  3142,3142,3143,3143,3144,3144,3145,3145,3146,3146,3147,3147,3148,3148,3149,3149,
+  3150,3150,3151,3151,3152,3152,3153,3153,3154,3154,3155,3155,3156,3156,3157,3157,
+  3158,3158,3159,3159,3160,3160,3161,3161,3162,3162,3163,3163,3164,3164,3165,3165,
+  3166,3166,3167,3167,3168,3168,3169,3169,3170,3170,3171,3171,3172,3172,3173,3173,
+  3174,3174,3175,3175,3176,3176,3177,3177,3178,3178,3179,3179,3180,3180,3181,3181,
+  3182,3182,3183,3183,3184,3184,3185,3185,3186,3186,3187,3187,3188,3188,3189,3189,
+  3190,3190,3191,3191,3192,3192,3192,3193,3193,3194,3194,3195,3195,3196,3196,3197,
+  3197,3198,3198,3199,3199,3200,3200,3201,3201,3202,3202,3203,3203,3204,3204,3205,
+  3205,3206,3206,3207,3207,3208,3208,3209,3209,3210,3210,3211,3211,3212,3212,3213,
+  3213,3214,3214,3215,3215,3215,3216,3216,3217,3217,3218,3218,3219,3219,3220,3220,
+  3221,3221,3222,3222,3223,3223,3224,3224,3225,3225,3226,3226,3227,3227,3228,3228,
+  3229,3229,3230,3230,3230,3231,3231,3232,3232,3233,3233,3234,3234,3235,3235,3236,
+  3236,3237,3237,3238,3238,3239,3239,3240,3240,3241,3241,3242,3242,3243,3243,3243,
+  3244,3244,3245,3245,3246,3246,3247,3247,3248,3248,3249,3249,3250,3250,3251,3251,
+  3252,3252,3253,3253,3254,3254,3254,3255,3255,3256,3256,3257,3257,3258,3258,3259,
+  3259,3260,3260,3261,3261,3262,3262,3263,3263,3264,3264,3264,3265,3265,3266,3266,
+  3267,3267,3268,3268,3269,3269,3270,3270,3271,3271,3272,3272,3273,3273,3273,3274,
+  3274,3275,3275,3276,3276,3277,3277,3278,3278,3279,3279,3280,3280,3281,3281,3281,
+  3282,3282,3283,3283,3284,3284,3285,3285,3286,3286,3287,3287,3288,3288,3289,3289,
+  3289,3290,3290,3291,3291,3292,3292,3293,3293,3294,3294,3295,3295,3296,3296,3296,
+  3297,3297,3298,3298,3299,3299,3300,3300,3301,3301,3302,3302,3302,3303,3303,3304,
+  3304,3305,3305,3306,3306,3307,3307,3308,3308,3309,3309,3309,3310,3310,3311,3311,
+  3312,3312,3313,3313,3314,3314,3315,3315,3315,3316,3316,3317,3317,3318,3318,3319,
+  3319,3320,3320,3321,3321,3321,3322,3322,3323,3323,3324,3324,3325,3325,3326,3326,
+  3326,3327,3327,3328,3328,3329,3329,3330,3330,3331,3331,3332,3332,3332,3333,3333,
+  3334,3334,3335,3335,3336,3336,3337,3337,3337,3338,3338,3339,3339,3340,3340,3341,
+  3341,3342,3342,3342,3343,3343,3344,3344,3345,3345,3346,3346,3347,3347,3347,3348,
+  3348,3349,3349,3350,3350,3351,3351,3351,3352,3352,3353,3353,3354,3354,3355,3355,
+  3356,3356,3356,3357,3357,3358,3358,3359,3359,3360,3360,3360,3361,3361,3362,3362,
+  3363,3363,3364,3364,3365,3365,3365,3366,3366,3367,3367,3368,3368,3369,3369,3369,
+  3370,3370,3371,3371,3372,3372,3373,3373,3373,3374,3374,3375,3375,3376,3376,3377,
+  3377,3377,3378,3378,3379,3379,3380,3380,3381,3381,3381,3382,3382,3383,3383,3384,
+  3384,3385,3385,3385,3386,3386,3387,3387,3388,3388,3389,3389,3389,3390,3390,3391,
+  3391,3392,3392,3392,3393,3393,3394,3394,3395,3395,3396,3396,3396,3397,3397,3398,
+  3398,3399,3399,3400,3400,3400,3401,3401,3402,3402,3403,3403,3403,3404,3404,3405,
+  3405,3406,3406,3407,3407,3407,3408,3408,3409,3409,3410,3410,3410,3411,3411,3412,
+  3412,3413,3413,3413,3414,3414,3415,3415,3416,3416,3417,3417,3417,3418,3418,3419,
+  3419,3420,3420,3420,3421,3421,3422,3422,3423,3423,3423,3424,3424,3425,3425,3426,
+  3426,3426,3427,3427,3428,3428,3429,3429,3429,3430,3430,3431,3431,3432,3432,3432,
+  3433,3433,3434,3434,3435,3435,3435,3436,3436,3437,3437,3438,3438,3438,3439,3439,
+  3440,3440,3441,3441,3441,3442,3442,3443,3443,3444,3444,3444,3445,3445,3446,3446,
+  3447,3447,3447,3448,3448,3449,3449,3449,3450,3450,3451,3451,3452,3452,3452,3453,
+  3453,3454,3454,3455,3455,3455,3456,3456,3457,3457,3457,3458,3458,3459,3459,3460,
+  3460,3460,3461,3461,3462,3462,3463,3463,3463,3464,3464,3465,3465,3465,3466,3466,
+  3467,3467,3468,3468,3468,3469,3469,3470,3470,3470,3471,3471,3472,3472,3473,3473,
+  3473,3474,3474,3475,3475,3475,3476,3476,3477,3477,3478,3478,3478,3479,3479,3480,
+  3480,3480,3481,3481,3482,3482,3483,3483,3483,3484,3484,3485,3485,3485,3486,3486,
+  3487,3487,3487,3488,3488,3489,3489,3490,3490,3490,3491,3491,3492,3492,3492,3493,
+  3493,3494,3494,3494,3495,3495,3496,3496,3497,3497,3497,3498,3498,3499,3499,3499,
+  3500,3500,3501,3501,3501,3502,3502,3503,3503,3503,3504,3504,3505,3505,3505,3506,
+  3506,3507,3507,3507,3508,3508,3509,3509,3510,3510,3510,3511,3511,3512,3512,3512,
+  3513,3513,3514,3514,3514,3515,3515,3516,3516,3516,3517,3517,3518,3518,3518,3519,
+  3519,3520,3520,3520,3521,3521,3522,3522,3522,3523,3523,3524,3524,3524,3525,3525,
+  3526,3526,3526,3527,3527,3528,3528,3528,3529,3529,3530,3530,3530,3531,3531,3532,
+  3532,3532,3533,3533,3534,3534,3534,3535,3535,3536,3536,3536,3537,3537,3538,3538,
+  3538,3539,3539,3540,3540,3540,3541,3541,3541,3542,3542,3543,3543,3543,3544,3544,
+  3545,3545,3545,3546,3546,3547,3547,3547,3548,3548,3549,3549,3549,3550,3550,3551,
+  3551,3551,3552,3552,3552,3553,3553,3554,3554,3554,3555,3555,3556,3556,3556,3557,
+  3557,3558,3558,3558,3559,3559,3559,3560,3560,3561,3561,3561,3562,3562,3563,3563,
+  3563,3564,3564,3565,3565,3565,3566,3566,3566,3567,3567,3568,3568,3568,3569,3569,
+  3570,3570,3570,3571,3571,3571,3572,3572,3573,3573,3573,3574,3574,3575,3575,3575,
+  3576,3576,3576,3577,3577,3578,3578,3578,3579,3579,3580,3580,3580,3581,3581,3581,
+  3582,3582,3583,3583,3583,3584,3584,3584,3585,3585,3586,3586,3586,3587,3587,3588,
+  3588,3588,3589,3589,3589,3590,3590,3591,3591,3591,3592,3592,3592,3593,3593,3594,
+  3594,3594,3595,3595,3595,3596,3596,3597,3597,3597,3598,3598,3598,3599,3599,3600,
+  3600,3600,3601,3601,3601,3602,3602,3603,3603,3603,3604,3604,3604,3605,3605,3606,
+  3606,3606,3607,3607,3607,3608,3608,3609,3609,3609,3610,3610,3610,3611,3611,3611,
+  3612,3612,3613,3613,3613,3614,3614,3614,3615,3615,3616,3616,3616,3617,3617,3617,
+  3618,3618,3618,3619,3619,3620,3620,3620,3621,3621,3621,3622,3622,3623,3623,3623,
+  3624,3624,3624,3625,3625,3625,3626,3626,3627,3627,3627,3628,3628,3628,3629,3629,
+  3629,3630,3630,3631,3631,3631,3632,3632,3632,3633,3633,3633,3634,3634,3635,3635,
+  3635,3636,3636,3636,3637,3637,3637,3638,3638,3639,3639,3639,3640,3640,3640,3641,
+  3641,3641,3642,3642,3642,3643,3643,3644,3644,3644,3645,3645,3645,3646,3646,3646,
+  3647,3647,3647,3648,3648,3649,3649,3649,3650,3650,3650,3651,3651,3651,3652,3652,
+  3652,3653,3653,3654,3654,3654,3655,3655,3655,3656,3656,3656,3657,3657,3657,3658,
+  3658,3658,3659,3659,3660,3660,3660,3661,3661,3661,3662,3662,3662,3663,3663,3663,
+  3664,3664,3664,3665,3665,3666,3666,3666,3667,3667,3667,3668,3668,3668,3669,3669,
+  3669,3670,3670,3670,3671,3671,3671,3672,3672,3673,3673,3673,3674,3674,3674,3675,
+  3675,3675,3676,3676,3676,3677,3677,3677,3678,3678,3678,3679,3679,3679,3680,3680,
+  3680,3681,3681,3682,3682,3682,3683,3683,3683,3684,3684,3684,3685,3685,3685,3686,
+  3686,3686,3687,3687,3687,3688,3688,3688,3689,3689,3689,3690,3690,3690,3691,3691,
+  3691,3692,3692,3692,3693,3693,3693,3694,3694,3694,3695,3695,3695,3696,3696,3697,
+  3697,3697,3698,3698,3698,3699,3699,3699,3700,3700,3700,3701,3701,3701,3702,3702,
+  3702,3703,3703,3703,3704,3704,3704,3705,3705,3705,3706,3706,3706,3707,3707,3707,
+  3708,3708,3708,3709,3709,3709,3710,3710,3710,3711,3711,3711,3712,3712,3712,3713,
+  3713,3713,3714,3714,3714,3715,3715,3715,3716,3716,3716,3717,3717,3717,3718,3718,
+  3718,3719,3719,3719,3720,3720,3720,3721,3721,3721,3721,3722,3722,3722,3723,3723,
+  3723,3724,3724,3724,3725,3725,3725,3726,3726,3726,3727,3727,3727,3728,3728,3728,
+  3729,3729,3729,3730,3730,3730,3731,3731,3731,3732,3732,3732,3733,3733,3733,3734,
+  3734,3734,3734,3735,3735,3735,3736,3736,3736,3737,3737,3737,3738,3738,3738,3739,
+  3739,3739,3740,3740,3740,3741,3741,3741,3742,3742,3742,3743,3743,3743,3743,3744,
+  3744,3744,3745,3745,3745,3746,3746,3746,3747,3747,3747,3748,3748,3748,3749,3749,
+  3749,3749,3750,3750,3750,3751,3751,3751,3752,3752,3752,3753,3753,3753,3754,3754,
+  3754,3755,3755,3755,3755,3756,3756,3756,3757,3757,3757,3758,3758,3758,3759,3759,
+  3759,3760,3760,3760,3760,3761,3761,3761,3762,3762,3762,3763,3763,3763,3764,3764,
+  3764,3764,3765,3765,3765,3766,3766,3766,3767,3767,3767,3768,3768,3768,3769,3769,
+  3769,3769,3770,3770,3770,3771,3771,3771,3772,3772,3772,3772,3773,3773,3773,3774,
+  3774,3774,3775,3775,3775,3776,3776,3776,3776,3777,3777,3777,3778,3778,3778,3779,
+  3779,3779,3779,3780,3780,3780,3781,3781,3781,3782,3782,3782,3783,3783,3783,3783,
+  3784,3784,3784,3785,3785,3785,3786,3786,3786,3786,3787,3787,3787,3788,3788,3788,
+  3789,3789,3789,3789,3790,3790,3790,3791,3791,3791,3791,3792,3792,3792,3793,3793,
+  3793,3794,3794,3794,3794,3795,3795,3795,3796,3796,3796,3797,3797,3797,3797,3798,
+  3798,3798,3799,3799,3799,3799,3800,3800,3800,3801,3801,3801,3801,3802,3802,3802,
+  3803,3803,3803,3804,3804,3804,3804,3805,3805,3805,3806,3806,3806,3806,3807,3807,
+  3807,3808,3808,3808,3808,3809,3809,3809,3810,3810,3810,3810,3811,3811,3811,3812,
+  3812,3812,3812,3813,3813,3813,3814,3814,3814,3815,3815,3815,3815,3816,3816,3816,
+  3816,3817,3817,3817,3818,3818,3818,3818,3819,3819,3819,3820,3820,3820,3820,3821,
+  3821,3821,3822,3822,3822,3822,3823,3823,3823,3824,3824,3824,3824,3825,3825,3825,
+  3826,3826,3826,3826,3827,3827,3827,3828,3828,3828,3828,3829,3829,3829,3829,3830,
+  3830,3830,3831,3831,3831,3831,3832,3832,3832,3833,3833,3833,3833,3834,3834,3834,
+  3834,3835,3835,3835,3836,3836,3836,3836,3837,3837,3837,3837,3838,3838,3838,3839,
+  3839,3839,3839,3840,3840,3840,3840,3841,3841,3841,3842,3842,3842,3842,3843,3843,
+  3843,3843,3844,3844,3844,3845,3845,3845,3845,3846,3846,3846,3846,3847,3847,3847,
+  3848,3848,3848,3848,3849,3849,3849,3849,3850,3850,3850,3850,3851,3851,3851,3852,
+  3852,3852,3852,3853,3853,3853,3853,3854,3854,3854,3854,3855,3855,3855,3856,3856,
+  3856,3856,3857,3857,3857,3857,3858,3858,3858,3858,3859,3859,3859,3859,3860,3860,
+  3860,3861,3861,3861,3861,3862,3862,3862,3862,3863,3863,3863,3863,3864,3864,3864,
+  3864,3865,3865,3865,3865,3866,3866,3866,3867,3867,3867,3867,3868,3868,3868,3868,
+  3869,3869,3869,3869,3870,3870,3870,3870,3871,3871,3871,3871,3872,3872,3872,3872,
+  3873,3873,3873,3873,3874,3874,3874,3874,3875,3875,3875,3876,3876,3876,3876,3877,
+  3877,3877,3877,3878,3878,3878,3878,3879,3879,3879,3879,3880,3880,3880,3880,3881,
+  3881,3881,3881,3882,3882,3882,3882,3883,3883,3883,3883,3884,3884,3884,3884,3885,
+  3885,3885,3885,3886,3886,3886,3886,3887,3887,3887,3887,3888,3888,3888,3888,3889,
+  3889,3889,3889,3890,3890,3890,3890,3890,3891,3891,3891,3891,3892,3892,3892,3892,
+  3893,3893,3893,3893,3894,3894,3894,3894,3895,3895,3895,3895,3896,3896,3896,3896,
+  3897,3897,3897,3897,3898,3898,3898,3898,3899,3899,3899,3899,3899,3900,3900,3900,
+  3900,3901,3901,3901,3901,3902,3902,3902,3902,3903,3903,3903,3903,3904,3904,3904,
+  3904,3904,3905,3905,3905,3905,3906,3906,3906,3906,3907,3907,3907,3907,3908,3908,
+  3908,3908,3908,3909,3909,3909,3909,3910,3910,3910,3910,3911,3911,3911,3911,3912,
+  3912,3912,3912,3912,3913,3913,3913,3913,3914,3914,3914,3914,3915,3915,3915,3915,
+  3915,3916,3916,3916,3916,3917,3917,3917,3917,3918,3918,3918,3918,3918,3919,3919,
+  3919,3919,3920,3920,3920,3920,3920,3921,3921,3921,3921,3922,3922,3922,3922,3923,
+  3923,3923,3923,3923,3924,3924,3924,3924,3925,3925,3925,3925,3925,3926,3926,3926,
+  3926,3927,3927,3927,3927,3927,3928,3928,3928,3928,3929,3929,3929,3929,3929,3930,
+  3930,3930,3930,3931,3931,3931,3931,3931,3932,3932,3932,3932,3933,3933,3933,3933,
+  3933,3934,3934,3934,3934,3935,3935,3935,3935,3935,3936,3936,3936,3936,3936,3937,
+  3937,3937,3937,3938,3938,3938,3938,3938,3939,3939,3939,3939,3939,3940,3940,3940,
+  3940,3941,3941,3941,3941,3941,3942,3942,3942,3942,3942,3943,3943,3943,3943,3944,
+  3944,3944,3944,3944,3945,3945,3945,3945,3945,3946,3946,3946,3946,3946,3947,3947,
+  3947,3947,3948,3948,3948,3948,3948,3949,3949,3949,3949,3949,3950,3950,3950,3950,
+  3950,3951,3951,3951,3951,3951,3952,3952,3952,3952,3953,3953,3953,3953,3953,3954,
+  3954,3954,3954,3954,3955,3955,3955,3955,3955,3956,3956,3956,3956,3956,3957,3957,
+  3957,3957,3957,3958,3958,3958,3958,3958,3959,3959,3959,3959,3959,3960,3960,3960,
+  3960,3960,3961,3961,3961,3961,3961,3962,3962,3962,3962,3962,3963,3963,3963,3963,
+  3963,3964,3964,3964,3964,3964,3965,3965,3965,3965,3965,3966,3966,3966,3966,3966,
+  3967,3967,3967,3967,3967,3968,3968,3968,3968,3968,3969,3969,3969,3969,3969,3969,
+  3970,3970,3970,3970,3970,3971,3971,3971,3971,3971,3972,3972,3972,3972,3972,3973,
+  3973,3973,3973,3973,3974,3974,3974,3974,3974,3974,3975,3975,3975,3975,3975,3976,
+  3976,3976,3976,3976,3977,3977,3977,3977,3977,3977,3978,3978,3978,3978,3978,3979,
+  3979,3979,3979,3979,3980,3980,3980,3980,3980,3980,3981,3981,3981,3981,3981,3982,
+  3982,3982,3982,3982,3982,3983,3983,3983,3983,3983,3984,3984,3984,3984,3984,3984,
+  3985,3985,3985,3985,3985,3986,3986,3986,3986,3986,3986,3987,3987,3987,3987,3987,
+  3988,3988,3988,3988,3988,3988,3989,3989,3989,3989,3989,3990,3990,3990,3990,3990,
+  3990,3991,3991,3991,3991,3991,3991,3992,3992,3992,3992,3992,3993,3993,3993,3993,
+  3993,3993,3994,3994,3994,3994,3994,3994,3995,3995,3995,3995,3995,3995,3996,3996,
+  3996,3996,3996,3996,3997,3997,3997,3997,3997,3998,3998,3998,3998,3998,3998,3999,
+  3999,3999,3999,3999,3999,4000,4000,4000,4000,4000,4000,4001,4001,4001,4001,4001,
+  4001,4002,4002,4002,4002,4002,4002,4003,4003,4003,4003,4003,4003,4004,4004,4004,
+  4004,4004,4004,4005,4005,4005,4005,4005,4005,4006,4006,4006,4006,4006,4006,4007,
+  4007,4007,4007,4007,4007,4007,4008,4008,4008,4008,4008,4008,4009,4009,4009,4009,
+  4009,4009,4010,4010,4010,4010,4010,4010,4011,4011,4011,4011,4011,4011,4012,4012,
+  4012,4012,4012,4012,4012,4013,4013,4013,4013,4013,4013,4014,4014,4014,4014,4014,
+  4014,4014,4015,4015,4015,4015,4015,4015,4016,4016,4016,4016,4016,4016,4016,4017,
+  4017,4017,4017,4017,4017,4018,4018,4018,4018,4018,4018,4018,4019,4019,4019,4019,
+  4019,4019,4020,4020,4020,4020,4020,4020,4020,4021,4021,4021,4021,4021,4021,4021,
+  4022,4022,4022,4022,4022,4022,4023,4023,4023,4023,4023,4023,4023,4024,4024,4024,
+  4024,4024,4024,4024,4025,4025,4025,4025,4025,4025,4025,4026,4026,4026,4026,4026,
+  4026,4026,4027,4027,4027,4027,4027,4027,4027,4028,4028,4028,4028,4028,4028,4028,
+  4029,4029,4029,4029,4029,4029,4029,4030,4030,4030,4030,4030,4030,4030,4031,4031,
+  4031,4031,4031,4031,4031,4032,4032,4032,4032,4032,4032,4032,4032,4033,4033,4033,
+  4033,4033,4033,4033,4034,4034,4034,4034,4034,4034,4034,4035,4035,4035,4035,4035,
+  4035,4035,4035,4036,4036,4036,4036,4036,4036,4036,4037,4037,4037,4037,4037,4037,
+  4037,4037,4038,4038,4038,4038,4038,4038,4038,4039,4039,4039,4039,4039,4039,4039,
+  4039,4040,4040,4040,4040,4040,4040,4040,4040,4041,4041,4041,4041,4041,4041,4041,
+  4041,4042,4042,4042,4042,4042,4042,4042,4042,4043,4043,4043,4043,4043,4043,4043,
+  4043,4044,4044,4044,4044,4044,4044,4044,4044,4045,4045,4045,4045,4045,4045,4045,
+  4045,4046,4046,4046,4046,4046,4046,4046,4046,4047,4047,4047,4047,4047,4047,4047,
+  4047,4048,4048,4048,4048,4048,4048,4048,4048,4048,4049,4049,4049,4049,4049,4049,
+  4049,4049,4050,4050,4050,4050,4050,4050,4050,4050,4050,4051,4051,4051,4051,4051,
+  4051,4051,4051,4052,4052,4052,4052,4052,4052,4052,4052,4052,4053,4053,4053,4053,
+  4053,4053,4053,4053,4053,4054,4054,4054,4054,4054,4054,4054,4054,4054,4055,4055,
+  4055,4055,4055,4055,4055,4055,4055,4056,4056,4056,4056,4056,4056,4056,4056,4056,
+  4057,4057,4057,4057,4057,4057,4057,4057,4057,4057,4058,4058,4058,4058,4058,4058,
+  4058,4058,4058,4059,4059,4059,4059,4059,4059,4059,4059,4059,4059,4060,4060,4060,
+  4060,4060,4060,4060,4060,4060,4061,4061,4061,4061,4061,4061,4061,4061,4061,4061,
+  4062,4062,4062,4062,4062,4062,4062,4062,4062,4062,4063,4063,4063,4063,4063,4063,
+  4063,4063,4063,4063,4064,4064,4064,4064,4064,4064,4064,4064,4064,4064,4065,4065,
+  4065,4065,4065,4065,4065,4065,4065,4065,4065,4066,4066,4066,4066,4066,4066,4066,
+  4066,4066,4066,4066,4067,4067,4067,4067,4067,4067,4067,4067,4067,4067,4068,4068,
+  4068,4068,4068,4068,4068,4068,4068,4068,4068,4069,4069,4069,4069,4069,4069,4069,
+  4069,4069,4069,4069,4069,4070,4070,4070,4070,4070,4070,4070,4070,4070,4070,4070,
+  4071,4071,4071,4071,4071,4071,4071,4071,4071,4071,4071,4071,4072,4072,4072,4072,
+  4072,4072,4072,4072,4072,4072,4072,4072,4073,4073,4073,4073,4073,4073,4073,4073,
+  4073,4073,4073,4073,4074,4074,4074,4074,4074,4074,4074,4074,4074,4074,4074,4074,
+  4075,4075,4075,4075,4075,4075,4075,4075,4075,4075,4075,4075,4075,4076,4076,4076,
+  4076,4076,4076,4076,4076,4076,4076,4076,4076,4076,4077,4077,4077,4077,4077,4077,
+  4077,4077,4077,4077,4077,4077,4077,4078,4078,4078,4078,4078,4078,4078,4078,4078,
+  4078,4078,4078,4078,4078,4079,4079,4079,4079,4079,4079,4079,4079,4079,4079,4079,
+  4079,4079,4079,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,
+  4080,4080,4081,4081,4081,4081,4081,4081,4081,4081,4081,4081,4081,4081,4081,4081,
+  4081,4082,4082,4082,4082,4082,4082,4082,4082,4082,4082,4082,4082,4082,4082,4082,
+  4082,4083,4083,4083,4083,4083,4083,4083,4083,4083,4083,4083,4083,4083,4083,4083,
+  4083,4084,4084,4084,4084,4084,4084,4084,4084,4084,4084,4084,4084,4084,4084,4084,
+  4084,4084,4085,4085,4085,4085,4085,4085,4085,4085,4085,4085,4085,4085,4085,4085,
+  4085,4085,4085,4085,4086,4086,4086,4086,4086,4086,4086,4086,4086,4086,4086,4086,
+  4086,4086,4086,4086,4086,4086,4086,4087,4087,4087,4087,4087,4087,4087,4087,4087,
+  4087,4087,4087,4087,4087,4087,4087,4087,4087,4087,4088,4088,4088,4088,4088,4088,
+  4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,
+  4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,
+  4089,4089,4089,4089,4089,4089,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,
+  4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4091,
+  4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,
+  4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4092,4092,4092,4092,4092,4092,
+  4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,
+  4092,4092,4092,4092,4092,4092,4092,4092,4092,4093,4093,4093,4093,4093,4093,4093,
+  4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,
+  4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4094,4094,
+  4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,
+  4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,
+  4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,
+  4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4096,
+  4096
+};
+
+/* Inputs where the reference result depends on the platform sine: sin(x) * 4096
+ * is within 4 float ulps of an integer, or the rounding of x in single precision
+ * breaks the symmetry of the quarter-wave table. They are computed with sin()
+ * like the Berry reference, so that results match on every libm (sorted). */
+static const int32_t sine_float_inputs[] = {
+  -32475, -31085, -29965, -29907, -29234, -28448, -27007, -26687, -26519, -25659,
+  -24902, -24739, -24579, -24578, -24577, -24576, -24575, -24574, -24573, -24413,
+  -24250, -23493, -22633, -22465, -22145, -21124, -20704, -19918, -19187, -18441,
+  -18297, -17916, -14327, -13581, -13523, -12850, -12064, -10623, -10303, -10135,
+  -9275, -8518, -8355, -8195, -8194, -8193, -8192, -8191, -8190, -8189,
+  -8029, -7866, -7109, -6249, -6081, -5761, -4320, -3534, -2861, -2803,
+  -2057, 0, 2057, 2803, 2861, 3534, 4320, 5761, 6081, 6249,
+  7109, 7866, 8029, 8189, 8190, 8191, 8192, 8193, 8194, 8195,
+  8355, 8518, 9275, 10135, 10303, 10623, 12064, 12850, 13523, 13581,
+  14327, 17916, 18297, 18441, 19187, 19918, 20704, 21124, 22145, 22465,
+  22633, 23493, 24250, 24413, 24573, 24574, 24575, 24576, 24577, 24578,
+  24579, 24739, 24902, 25659, 26519, 26687, 27007, 28448, 29234, 29907,
+  29965, 31085, 32475, 34300, 34681, 34825, 35629, 35899, 36302, 37508,
+  38262, 38529, 38849, 39017, 39877, 40634, 40797, 40957, 40958, 40959,
+  40960, 40961, 40962, 40963, 41123, 41286, 42043, 42903, 42992, 43391,
+  44006, 44492, 44832, 45618, 46291, 46349, 47469, 47620, 48859, 50454,
+  50684, 51065, 51209, 52013, 52686, 53892, 54646, 54913, 55233, 55401,
+  56261, 57018, 57181, 57341, 57342, 57343, 57344, 57345, 57346, 57347,
+  57507, 57670, 59287, 59455, 59775, 60200, 60796, 61216, 62002, 62675,
+  62733, 63853, 64858, 65243
+};
+
+#define SINE_FLOAT_INPUTS_SIZE  ((int)(sizeof(sine_float_inputs) / sizeof(sine_float_inputs[0])))
+
+/* same computation as the Berry reference, used outside of the table range */
+static bint sine_int_float(bint i)
+{
+    breal x = (breal)i / (breal)16384.0;
+    x = x * (breal)SINE_PI;
+    breal y = mathfunc(sin)(x);
+    y = y * (breal)4096;
+    return (bint)y;
+}
+
+static bbool sine_is_float_input(bint i)
+{
+    int lo = 0, hi = SINE_FLOAT_INPUTS_SIZE - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (sine_float_inputs[mid] < i) {
+            lo = mid + 1;
+        } else if (sine_float_inputs[mid] > i) {
+            hi = mid - 1;
+        } else {
+            return btrue;
+        }
+    }
+    return bfalse;
+}
+
+static bint sine_int(bint i)
+{
+    if (i < SINE_DOMAIN_MIN || i > SINE_DOMAIN_MAX || sine_is_float_input(i)) {
+        return sine_int_float(i);
+    }
+    int p = (int)(i & (SINE_PERIOD - 1));
+    bint v;
+    if (p <= SINE_QUARTER) {
+        v = sine_quarter[p];
+    } else if (p <= 2 * SINE_QUARTER) {
+        v = sine_quarter[2 * SINE_QUARTER - p];
+    } else if (p <= 3 * SINE_QUARTER) {
+        v = -sine_quarter[p - 2 * SINE_QUARTER];
+    } else {
+        v = -sine_quarter[SINE_PERIOD - p];
+    }
+    return v;
+}
+
+/* Multiplication wrapping around on overflow like the Berry VM does,
+ * signed overflow being undefined in C */
+static bint mul_wrap(bint a, bint b)
+{
+    return (bint)((unsigned BE_INTEGER)a * (unsigned BE_INTEGER)b);
+}
+
+/* Same as `Tasmota.scale_uint()` in Berry, returns -1 in `*err` on division by zero */
+static bint scale_uint(bint num, bint from_min, bint from_max, bint to_min, bint to_max, int *err)
+{
+    if (from_min >= from_max) {
+        return (to_min > to_max ? to_max : to_min);  /* invalid input, return arbitrary value */
+    }
+    /* check source range */
+    num = (num > from_max ? from_max : (num < from_min ? from_min : num));
+    /* check to_* order */
+    if (to_min > to_max) {
+        bint tmp = to_min;
+        num = (from_max - num) + from_min;
+        to_min = to_max;
+        to_max = tmp;
+    }
+    /* short-cut if limits to avoid rounding errors */
+    if (num == from_min) { return to_min; }
+    if (num == from_max) { return to_max; }
+
+    bint result, numerator, denominator;
+    if ((num - from_min) < 0x8000) {
+        if (to_max - to_min > from_max - from_min) {
+            numerator = mul_wrap(mul_wrap(num - from_min, to_max - to_min), 2);
+            denominator = from_max - from_min;
+            if (denominator == 0) { *err = -1; return 0; }
+            result = ((numerator / denominator) + 1) / 2 + to_min;
+        } else {
+            numerator = mul_wrap((num - from_min) * 2 + 1, to_max - to_min + 1);
+            denominator = (from_max - from_min + 1) * 2;
+            if (denominator == 0) { *err = -1; return 0; }
+            result = numerator / denominator + to_min;
+        }
+    } else {
+        numerator = mul_wrap(num - from_min, to_max - to_min + 1);
+        denominator = from_max - from_min;
+        if (denominator == 0) { *err = -1; return 0; }
+        result = numerator / denominator + to_min;
+    }
+    return (result > to_max ? to_max : (result < to_min ? to_min : result));
+}
+
+/* Same as `Tasmota.scale_int()` in Berry */
+static bint scale_int(bint num, bint from_min, bint from_max, bint to_min, bint to_max, int *err)
+{
+    if (from_min >= from_max) {
+        return (to_min > to_max ? to_max : to_min);  /* invalid input, return arbitrary value */
+    }
+    bint from_offset = 0;
+    if (from_min < 0) {
+        from_offset = -from_min;
+    }
+    bint to_offset = 0;
+    if (to_min < 0) {
+        to_offset = -to_min;
+    }
+    if (to_max < -to_offset) {
+        to_offset = -to_max;
+    }
+    return scale_uint(num + from_offset, from_min + from_offset, from_max + from_offset,
+                      to_min + to_offset, to_max + to_offset, err) - to_offset;
+}
+
+static void check_err(bvm *vm, int err)
+{
+    if (err) {
+        be_raise(vm, "divzero_error", "division by zero");
+    }
+}
+
+// Berry: `tasmota_ntv.scale_uint(num:int, from_min:int, from_max:int, to_min:int, to_max:int) -> int`
+static int m_scale_uint(bvm *vm)
+{
+    if (be_top(vm) >= 5) {
+        int err = 0;
+        bint r = scale_uint(be_toint(vm, 1), be_toint(vm, 2), be_toint(vm, 3),
+                            be_toint(vm, 4), be_toint(vm, 5), &err);
+        check_err(vm, err);
+        be_pushint(vm, r);
+        be_return(vm);
+    }
+    be_raise(vm, "value_error", "scale_uint requires 5 arguments");
+    be_return_nil(vm);
+}
+
+// Berry: `tasmota_ntv.scale_int(num:int, from_min:int, from_max:int, to_min:int, to_max:int) -> int`
+static int m_scale_int(bvm *vm)
+{
+    if (be_top(vm) >= 5) {
+        int err = 0;
+        bint r = scale_int(be_toint(vm, 1), be_toint(vm, 2), be_toint(vm, 3),
+                           be_toint(vm, 4), be_toint(vm, 5), &err);
+        check_err(vm, err);
+        be_pushint(vm, r);
+        be_return(vm);
+    }
+    be_raise(vm, "value_error", "scale_int requires 5 arguments");
+    be_return_nil(vm);
+}
+
+// Berry: `tasmota_ntv.sine_int(i:int) -> int`
+static int m_sine_int(bvm *vm)
+{
+    if (be_top(vm) >= 1) {
+        be_pushint(vm, sine_int(be_toint(vm, 1)));
+        be_return(vm);
+    }
+    be_raise(vm, "value_error", "sine_int requires 1 argument");
+    be_return_nil(vm);
+}
+
+// Berry: `tasmota_ntv.scale_uint_buf(buf:bytes, from_min:int, from_max:int, to_min:int, to_max:int [, width:int]) -> bytes`
+// Scales in place every unsigned element of `buf`, elements are 1 (default) or 2 bytes little endian.
+// Results are truncated to the element width.
+static int m_scale_uint_buf(bvm *vm)
+{
+    if (be_top(vm) >= 5 && be_isbytes(vm, 1)) {
+        size_t len;
+        uint8_t *buf = (uint8_t*) be_tobytes(vm, 1, &len);
+        bint from_min = be_toint(vm, 2);
+        bint from_max = be_toint(vm, 3);
+        bint to_min = be_toint(vm, 4);
+        bint to_max = be_toint(vm, 5);
+        bint width = be_top(vm) >= 6 ? be_toint(vm, 6) : 1;
+        int err = 0;
+        if (width == 1) {
+            for (size_t i = 0; i < len; i++) {
+                buf[i] = (uint8_t) scale_uint(buf[i], from_min, from_max, to_min, to_max, &err);
+            }
+        } else if (width == 2) {
+            for (size_t i = 0; i + 1 < len; i += 2) {
+                bint v = scale_uint(buf[i] | (buf[i + 1] << 8), from_min, from_max, to_min, to_max, &err);
+                buf[i] = (uint8_t) v;
+                buf[i + 1] = (uint8_t) (v >> 8);
+            }
+        } else {
+            be_raise(vm, "value_error", "width must be 1 or 2");
+        }
+        check_err(vm, err);
+        be_pushvalue(vm, 1);
+        be_return(vm);
+    }
+    be_raise(vm, "type_error", "scale_uint_buf requires bytes and 4 int arguments");
+    be_return_nil(vm);
+}
+
+#if !BE_USE_PRECOMPILED_OBJECT
+be_native_module_attr_table(tasmota_ntv) {
+    be_native_module_function("scale_uint", m_scale_uint),
+    be_native_module_function("scale_int", m_scale_int),
+    be_native_module_function("sine_int", m_sine_int),
+    be_native_module_function("scale_uint_buf", m_scale_uint_buf),
+};
+
+be_define_native_module(tasmota_ntv, NULL);
+#else
+/* @const_object_info_begin
+module tasmota_ntv (scope: global) {
+    scale_uint, func(m_scale_uint)
+    scale_int, func(m_scale_int)
+    sine_int, func(m_sine_int)
+    scale_uint_buf, func(m_scale_uint_buf)
+}
+@const_object_info_end */
+#include "../generate/be_fixed_tasmota_ntv.h"
+#endif
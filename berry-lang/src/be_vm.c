@@ -21,6 +21,8 @@
 #include "be_exec.h"
 #include "be_debug.h"
 #include "be_libs.h"
+#include "be_profiler.h"
+#include "be_bytecode.h"
 #include <string.h>
 #include <math.h>
 
@@ -65,11 +67,21 @@
   #define VM_HEARTBEAT()
 #endif
 
+#if BE_USE_PROFILER
+  #define PROFILER_HOOK() \
+    if (vm->profile_countdown && --vm->profile_countdown == 0) { /* sample every period or on timer */ \
+        be_profiler_sample(vm); \
+    }
+#else
+  #define PROFILER_HOOK()
+#endif
+
 #define vm_exec_loop() \
     loop: \
         DEBUG_HOOK(); \
         COUNTER_HOOK(); \
         VM_HEARTBEAT(); \
+        PROFILER_HOOK(); \
         switch (IGET_OP(ins = *vm->ip++))
 
 #if BE_USE_SINGLE_FLOAT
@@ -540,7 +552,13 @@ BERRY_API bvm* be_vm_new(void)
 
 BERRY_API void be_vm_delete(bvm *vm)
 {
+#if BE_USE_PROFILER
+    be_profiler_delete(vm);
+#endif
     be_gc_deleteall(vm);
+#if BE_USE_BYTECODE_LOADER && BE_USE_BYTECODE_MMAP
+    be_bytecode_unmap_all(vm); /* after the protos executing in place are freed */
+#endif
     be_string_deleteall(vm);
     be_stack_delete(vm, &vm->callstack);
     be_stack_delete(vm, &vm->refstack);
@@ -9,6 +9,9 @@
 #define BE_VM_H
 
 #include "be_object.h"
+#if BE_USE_PROFILER
+#include <signal.h>
+#endif
 
 #define comp_is_named_gbl(vm)       ((vm)->compopt & (1<<COMP_NAMED_GBL))
 #define comp_set_named_gbl(vm)      ((vm)->compopt |= (1<<COMP_NAMED_GBL))
@@ -150,6 +153,14 @@ struct bvm {
     bvalue hook;
     bbyte hookmask;
 #endif
+#if BE_USE_BYTECODE_LOADER && BE_USE_BYTECODE_MMAP
+    struct bmapping *mappings; /* bytecode files executed in place, unmapped when the VM is deleted */
+#endif
+#if BE_USE_PROFILER
+    struct bprofiler *profiler; /* sampling profiler, NULL until started */
+    volatile sig_atomic_t profile_countdown; /* instructions before the next sample, 0 when idle, set by SIGPROF */
+    int profile_alloc_type; /* type of the GC object being allocated, 0 for raw data */
+#endif
 };
 
 #define NONE_FLAG           0
@@ -2257,6 +2257,23 @@ BERRY_API int be_loadbuffer_local(bvm *vm, const char *name, const char *buffer,
  */
 BERRY_API int be_loadmode(bvm *vm, const char *name, bbool islocal);
 
+/**
+ * @fn int be_loadbytecode(bvm*, const void*, size_t, bbool)
+ * @note code load API
+ * @brief load a bytecode file image from a buffer
+ *
+ * If loading is successful, the Berry function is placed on the top of the virtual stack. Otherwise
+ * an error value of type berrorcode is returned, with the error message on the top of the virtual stack.
+ *
+ * @param vm virtual machine instance
+ * @param buffer buffer holding the content of a bytecode file
+ * @param length length of the buffer
+ * @param shared if true, the buffer must remain valid and unchanged for the lifetime of the VM,
+ *               like a constant data segment, and instructions are executed in place instead of being copied
+ * @return BE_OK if successful
+ */
+BERRY_API int be_loadbytecode(bvm *vm, const void *buffer, size_t length, bbool shared);
+
 /**
  * @fn int be_loadlib(bvm*, const char*)
  * @note code load API
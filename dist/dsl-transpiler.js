@@ -195,10 +195,11 @@
                     .replace(/\t/g, '\\t');  // Escape tabs
                 
                 // Call the transpiler
-                // The animation_dsl.compile() function takes a string and returns Berry code
+                // The animation_dsl.compile_incremental() function takes a string and returns Berry code,
+                // reusing the code of statements unchanged since the previous call
                 const compileCode = `
 try
-    global._dsl_transpiler_result = animation_dsl.compile("${escapedCode}")
+    global._dsl_transpiler_result = animation_dsl.compile_incremental("${escapedCode}")
     global._dsl_transpiler_error = nil
 except .. as e, msg
     global._dsl_transpiler_result = nil
@@ -17,6 +17,22 @@ extern int be_animation_ntv_blend_color(bvm *vm);
 extern int be_animation_ntv_apply_opacity(bvm *vm);
 extern int be_animation_ntv_apply_brightness(bvm *vm);
 extern int be_animation_ntv_fill_pixels(bvm *vm);
+extern int be_animation_ntv_fire_heat_step(bvm *vm);
+extern int be_animation_ntv_fire_heat_to_argb(bvm *vm);
+extern int be_animation_ntv_interpolate_pixels(bvm *vm);
+extern int be_animation_ntv_frame_encode(bvm *vm);
+extern int be_animation_ntv_frame_decode(bvm *vm);
+extern int be_animation_ntv_fill_rect_pixels(bvm *vm);
+extern int be_animation_ntv_draw_line_pixels(bvm *vm);
+extern int be_animation_ntv_blit_pixels(bvm *vm);
+extern int be_animation_ntv_scroll_pixels(bvm *vm);
+extern int be_animation_ntv_matrix_remap(bvm *vm);
+extern int be_animation_ntv_remap_pixels(bvm *vm);
+extern int be_animation_ntv_blend_pixels16(bvm *vm);
+extern int be_animation_ntv_dither_pixels(bvm *vm);
+extern int be_animation_ntv_palette_lut(bvm *vm);
+extern int be_animation_ntv_oscillator_value(bvm *vm);
+extern int be_animation_ntv_oscillator_fill(bvm *vm);
 
 BE_EXPORT_VARIABLE extern const bclass be_class_bytes;
 
@@ -31,6 +47,28 @@ class be_class_FrameBufferNtv (scope: global, name: FrameBufferNtv, strings: wea
   apply_opacity, static_func(be_animation_ntv_apply_opacity)
   apply_brightness, static_func(be_animation_ntv_apply_brightness)
   fill_pixels, static_func(be_animation_ntv_fill_pixels)
+  // fire simulation kernels
+  fire_heat_step, static_func(be_animation_ntv_fire_heat_step)
+  fire_heat_to_argb, static_func(be_animation_ntv_fire_heat_to_argb)
+  // frame cache kernels
+  interpolate_pixels, static_func(be_animation_ntv_interpolate_pixels)
+  frame_encode, static_func(be_animation_ntv_frame_encode)
+  frame_decode, static_func(be_animation_ntv_frame_decode)
+  // 2D matrix kernels
+  fill_rect_pixels, static_func(be_animation_ntv_fill_rect_pixels)
+  draw_line_pixels, static_func(be_animation_ntv_draw_line_pixels)
+  blit_pixels, static_func(be_animation_ntv_blit_pixels)
+  scroll_pixels, static_func(be_animation_ntv_scroll_pixels)
+  matrix_remap, static_func(be_animation_ntv_matrix_remap)
+  remap_pixels, static_func(be_animation_ntv_remap_pixels)
+  // high precision kernels
+  blend_pixels16, static_func(be_animation_ntv_blend_pixels16)
+  dither_pixels, static_func(be_animation_ntv_dither_pixels)
+  // palette kernels
+  palette_lut, static_func(be_animation_ntv_palette_lut)
+  // oscillator kernels
+  oscillator_value, static_func(be_animation_ntv_oscillator_value)
+  oscillator_fill, static_func(be_animation_ntv_oscillator_fill)
 //   paste_pixels, func(be_leds_paste_pixels)
 }
 @const_object_info_end */
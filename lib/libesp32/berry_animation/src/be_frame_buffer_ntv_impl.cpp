@@ -21,6 +21,8 @@
 #ifdef USE_BERRY
 
 #include <berry.h>
+#include <string.h>
+#include <math.h>
 
 #ifdef USE_WS2812
 #ifdef USE_BERRY_ANIMATION
@@ -604,6 +606,946 @@ extern "C" {
     be_return_nil(vm);
   }
 
+  // Linear congruential generator shared by the fire kernels, identical to
+  // the one used by the Berry implementation of FireAnimation
+  static inline uint32_t fire_random_range(uint32_t *seed, uint32_t max) {
+    *seed = (*seed * 1103515245 + 12345) & 0x7FFFFFFF;
+    return *seed % max;
+  }
+
+  // frame_buffer_ntv.fire_heat_step(heat:bytes(), seed:int, cooling_rate:int, sparking_rate:int [, width:int]) -> int
+  // Advance a fire heat map by one step: cooling, drift and diffusion, sparking
+  // In 2D mode (width > 1) the buffer is stored row by row with row 0 at the bottom,
+  // each column burning independently
+  // Returns the new random seed
+  int32_t be_animation_ntv_fire_heat_step(bvm *vm);
+  int32_t be_animation_ntv_fire_heat_step(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    size_t heat_len = 0;
+    uint8_t * heat = (uint8_t*) be_tobytes(vm, 1, &heat_len);
+    if (heat == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() argument");
+    }
+    uint32_t seed = be_toint(vm, 2);
+    int32_t cooling_rate = be_toint(vm, 3);
+    int32_t sparking_rate = be_toint(vm, 4);
+    int32_t width = 1;
+    if (top >= 5 && be_isint(vm, 5)) {
+      width = be_toint(vm, 5);
+    }
+    if (width < 1) { width = 1; }
+    int32_t height = heat_len / width;
+    uint32_t cool_max = changeUIntScale(cooling_rate, 0, 255, 0, 10) + 2;
+
+    for (int32_t x = 0; x < width; x++) {
+      uint8_t * col = heat + x;
+      // Step 1: Cool down every pixel a little
+      for (int32_t y = 0; y < height; y++) {
+        uint32_t cooldown = fire_random_range(&seed, cool_max);
+        uint32_t h = col[y * width];
+        col[y * width] = (cooldown >= h) ? 0 : h - cooldown;
+      }
+      // Step 2: Heat from each pixel drifts 'up' and diffuses a little
+      for (int32_t k = height - 1; k >= 2; k--) {
+        col[k * width] = (col[(k - 1) * width] + col[(k - 2) * width] + col[(k - 2) * width]) / 3;
+      }
+      // Step 3: Randomly ignite new 'sparks' of heat near the bottom
+      if ((int32_t)fire_random_range(&seed, 255) < sparking_rate) {
+        int32_t spark_pos = fire_random_range(&seed, 7);          // Sparks only in bottom 7 pixels
+        uint32_t spark_heat = fire_random_range(&seed, 95) + 160; // Heat between 160-254
+        if (spark_pos < height) {
+          col[spark_pos * width] = spark_heat;
+        }
+      }
+    }
+
+    be_pushint(vm, seed);
+    be_return(vm);
+  }
+
+  // frame_buffer_ntv.fire_heat_to_argb(heat:bytes(), colors:bytes(), seed:int, intensity:int, flicker_amount:int, palette:int|bytes() [, brightness:int]) -> int
+  // Convert a fire heat map to ARGB colors with random flicker
+  // palette is either a color scaled by heat, or a LUT of 256 entries (indexed by heat)
+  // or 129 entries (indexed by heat / 2, color provider LUT layout)
+  // A shorter LUT is clamped to its last entry, an empty one renders black
+  // Returns the new random seed
+  int32_t be_animation_ntv_fire_heat_to_argb(bvm *vm);
+  int32_t be_animation_ntv_fire_heat_to_argb(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    size_t heat_len = 0;
+    const uint8_t * heat = (const uint8_t*) be_tobytes(vm, 1, &heat_len);
+    size_t colors_len = 0;
+    uint32_t * colors = (uint32_t*) be_tobytes(vm, 2, &colors_len);
+    if (heat == NULL || colors == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    uint32_t seed = be_toint(vm, 3);
+    uint32_t intensity = be_toint(vm, 4);
+    uint32_t flicker_amount = be_toint(vm, 5);
+    const uint32_t * lut = NULL;
+    size_t lut_len = 0;
+    size_t lut_max = 0;     // last valid LUT index
+    uint32_t color = 0;
+    if (be_isbytes(vm, 6)) {
+      lut = (const uint32_t*) be_tobytes(vm, 6, &lut_len);
+      if (lut_len < 4) {
+        lut = NULL;           // empty LUT, heat scales black
+        color = 0xFF000000;
+      } else {
+        lut_max = lut_len / 4 - 1;
+      }
+    } else {
+      color = be_toint(vm, 6);
+    }
+    uint32_t brightness = 255;
+    if (top >= 7 && be_isint(vm, 7)) {
+      brightness = be_toint(vm, 7);
+    }
+    bool lut_full = (lut_len >= 256 * 4);
+
+    size_t pixels = heat_len;
+    if (pixels > colors_len / 4) { pixels = colors_len / 4; }
+
+    for (size_t i = 0; i < pixels; i++) {
+      // Apply base intensity scaling
+      uint32_t h = changeUIntScale(heat[i], 0, 255, 0, intensity);
+      // Add flicker effect
+      if (flicker_amount > 0) {
+        uint32_t flicker = fire_random_range(&seed, flicker_amount);
+        if (fire_random_range(&seed, 2) == 0) {
+          h += flicker;
+          if (h > 255) { h = 255; }
+        } else {
+          h = (h > flicker) ? h - flicker : 0;
+        }
+      }
+
+      uint32_t argb = 0xFF000000;   // Default to black
+      if (h > 0) {
+        if (lut != NULL) {
+          uint32_t lut_index = lut_full ? h : ((h >= 255) ? 128 : h >> 1);
+          if (lut_index > lut_max) { lut_index = lut_max; }
+          argb = lut[lut_index];
+          if (brightness != 255) {
+            uint32_t r = changeUIntScale((argb >> 16) & 0xFF, 0, 255, 0, brightness);
+            uint32_t g = changeUIntScale((argb >>  8) & 0xFF, 0, 255, 0, brightness);
+            uint32_t b = changeUIntScale((argb      ) & 0xFF, 0, 255, 0, brightness);
+            argb = (argb & 0xFF000000) | (r << 16) | (g << 8) | b;
+          }
+        } else {
+          // Apply heat as brightness scaling of a single color
+          uint32_t r = changeUIntScale(h, 0, 255, 0, (color >> 16) & 0xFF);
+          uint32_t g = changeUIntScale(h, 0, 255, 0, (color >>  8) & 0xFF);
+          uint32_t b = changeUIntScale(h, 0, 255, 0, (color      ) & 0xFF);
+          argb = (color & 0xFF000000) | (r << 16) | (g << 8) | b;
+        }
+      }
+      colors[i] = argb;
+    }
+
+    be_pushint(vm, seed);
+    be_return(vm);
+  }
+
+  // frame_buffer_ntv.interpolate_pixels(dest:bytes(), pixels1:bytes(), pixels2:bytes(), factor:int) -> nil
+  // Linear interpolation between two pixel buffers, per channel including alpha
+  // factor: 0 = pixels1, 255 = pixels2
+  int32_t be_animation_ntv_interpolate_pixels(bvm *vm);
+  int32_t be_animation_ntv_interpolate_pixels(bvm *vm) {
+    size_t dest_len = 0, len1 = 0, len2 = 0;
+    uint32_t * dest = (uint32_t*) be_tobytes(vm, 1, &dest_len);
+    const uint32_t * pixels1 = (const uint32_t*) be_tobytes(vm, 2, &len1);
+    const uint32_t * pixels2 = (const uint32_t*) be_tobytes(vm, 3, &len2);
+    if (dest == NULL || pixels1 == NULL || pixels2 == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    uint32_t factor = be_toint(vm, 4);
+    size_t width = dest_len / 4;
+    if (width > len1 / 4) { width = len1 / 4; }
+    if (width > len2 / 4) { width = len2 / 4; }
+
+    for (size_t i = 0; i < width; i++) {
+      uint32_t c1 = pixels1[i];
+      uint32_t c2 = pixels2[i];
+      if (c1 != c2) {
+        uint32_t a = changeUIntScale(factor, 0, 255, (c1 >> 24) & 0xFF, (c2 >> 24) & 0xFF);
+        uint32_t r = changeUIntScale(factor, 0, 255, (c1 >> 16) & 0xFF, (c2 >> 16) & 0xFF);
+        uint32_t g = changeUIntScale(factor, 0, 255, (c1 >>  8) & 0xFF, (c2 >>  8) & 0xFF);
+        uint32_t b = changeUIntScale(factor, 0, 255, (c1      ) & 0xFF, (c2      ) & 0xFF);
+        c1 = (a << 24) | (r << 16) | (g << 8) | b;
+      }
+      dest[i] = c1;
+    }
+    be_return_nil(vm);
+  }
+
+  // Encode frame runs, see frame_encode(); if out is NULL only compute the size
+  static size_t frame_encode_runs(const uint32_t * pixels, const uint32_t * prev, size_t width, uint8_t * out) {
+    size_t len = 0;
+    size_t i = 0;
+    while (i < width) {
+      uint32_t c = pixels[i];
+      size_t j = i + 1;
+      uint32_t header;
+      if (prev != NULL && c == prev[i]) {
+        // skip run
+        while (j < width && (j - i) < 0x3FFF && pixels[j] == prev[j]) { j++; }
+        header = 0x8000 | (j - i);
+      } else {
+        while (j < width && (j - i) < 0x3FFF && pixels[j] == c) { j++; }
+        if ((j - i) >= 2) {
+          header = (j - i);         // fill run
+        } else {
+          // literal run, stops before a skip or fill run
+          while (j < width && (j - i) < 0x3FFF) {
+            uint32_t cj = pixels[j];
+            if (prev != NULL && cj == prev[j]) { break; }
+            if (j + 1 < width && cj == pixels[j + 1]) { break; }
+            j++;
+          }
+          header = 0x4000 | (j - i);
+        }
+      }
+      if (out) {
+        out[len] = header & 0xFF;
+        out[len + 1] = header >> 8;
+      }
+      len += 2;
+      uint32_t op = header >> 14;
+      if (op == 0) {
+        if (out) { memcpy(out + len, &c, 4); }
+        len += 4;
+      } else if (op == 1) {
+        if (out) { memcpy(out + len, pixels + i, (j - i) * 4); }
+        len += (j - i) * 4;
+      }
+      i = j;
+    }
+    return len;
+  }
+
+  // frame_buffer_ntv.frame_encode(pixels:bytes() [, prev_pixels:bytes()]) -> bytes()
+  // Encode a frame as fill/literal/skip runs, skip runs are only emitted
+  // if the previous frame is provided (delta encoding)
+  int32_t be_animation_ntv_frame_encode(bvm *vm);
+  int32_t be_animation_ntv_frame_encode(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    size_t pixels_len = 0;
+    const uint32_t * pixels = (const uint32_t*) be_tobytes(vm, 1, &pixels_len);
+    if (pixels == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() argument");
+    }
+    size_t width = pixels_len / 4;
+    const uint32_t * prev = NULL;
+    if (top >= 2 && be_isbytes(vm, 2)) {
+      size_t prev_len = 0;
+      prev = (const uint32_t*) be_tobytes(vm, 2, &prev_len);
+      if (prev_len < width * 4) { prev = NULL; }
+    }
+    size_t len = frame_encode_runs(pixels, prev, width, NULL);
+    uint8_t * out = (uint8_t*) be_pushbytes(vm, NULL, len);
+    frame_encode_runs(pixels, prev, width, out);
+    be_return(vm);
+  }
+
+  // frame_buffer_ntv.frame_decode(data:bytes(), pixels:bytes()) -> nil
+  // Decode a frame encoded with frame_encode() into pixels, which must hold
+  // the previous frame if the frame was delta encoded
+  int32_t be_animation_ntv_frame_decode(bvm *vm);
+  int32_t be_animation_ntv_frame_decode(bvm *vm) {
+    size_t data_len = 0, pixels_len = 0;
+    const uint8_t * data = (const uint8_t*) be_tobytes(vm, 1, &data_len);
+    uint32_t * pixels = (uint32_t*) be_tobytes(vm, 2, &pixels_len);
+    if (data == NULL || pixels == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    size_t width = pixels_len / 4;
+    size_t pos = 0;
+    size_t i = 0;
+    while (pos + 2 <= data_len && i < width) {
+      uint32_t header = data[pos] | (data[pos + 1] << 8);
+      pos += 2;
+      uint32_t op = header >> 14;
+      size_t n = header & 0x3FFF;
+      if (i + n > width) { n = width - i; }
+      if (op == 0) {
+        if (pos + 4 > data_len) { break; }
+        uint32_t c;
+        memcpy(&c, data + pos, 4);
+        pos += 4;
+        for (size_t k = 0; k < n; k++) { pixels[i + k] = c; }
+      } else if (op == 1) {
+        size_t avail = (data_len - pos) / 4;
+        size_t m = (n < avail) ? n : avail;
+        memcpy(pixels + i, data + pos, m * 4);
+        pos += (header & 0x3FFF) * 4;
+      }
+      i += n;
+    }
+    be_return_nil(vm);
+  }
+
+  // Blend color2 over color1 using color2's alpha, same as blend()
+  static inline uint32_t blend_argb(uint32_t color1, uint32_t color2) {
+    uint32_t a2 = (color2 >> 24) & 0xFF;
+    if (a2 == 0) { return color1; }
+    if (a2 == 255) { return color2; }
+    uint32_t a1 = (color1 >> 24) & 0xFF;
+    uint8_t r = changeUIntScale(255 - a2, 0, 255, 0, (color1 >> 16) & 0xFF) + changeUIntScale(a2, 0, 255, 0, (color2 >> 16) & 0xFF);
+    uint8_t g = changeUIntScale(255 - a2, 0, 255, 0, (color1 >>  8) & 0xFF) + changeUIntScale(a2, 0, 255, 0, (color2 >>  8) & 0xFF);
+    uint8_t b = changeUIntScale(255 - a2, 0, 255, 0, (color1      ) & 0xFF) + changeUIntScale(a2, 0, 255, 0, (color2      ) & 0xFF);
+    uint32_t a = a1 + changeUIntScale((255 - a1) * a2, 0, 255 * 255, 0, 255);
+    if (a > 255) { a = 255; }
+    return (a << 24) | (r << 16) | (g << 8) | b;
+  }
+
+  // Fill a clipped rectangle of a 2D buffer stored row by row
+  static void fill_rect_argb(uint32_t * pixels, int32_t cols, int32_t rows, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > cols) { w = cols - x; }
+    if (y + h > rows) { h = rows - y; }
+    if (w <= 0 || h <= 0) { return; }
+    for (int32_t j = y; j < y + h; j++) {
+      uint32_t * row = pixels + j * cols + x;
+      for (int32_t i = 0; i < w; i++) { row[i] = color; }
+    }
+  }
+
+  // Copy a clipped rectangle between 2D buffers, dest and src may overlap
+  static void blit_argb(uint32_t * dest, int32_t dest_cols, int32_t dest_rows,
+                        const uint32_t * src, int32_t src_cols, int32_t src_rows,
+                        int32_t dx, int32_t dy, int32_t sx, int32_t sy, int32_t w, int32_t h, bool blend) {
+    // Clip to source then to destination
+    if (sx < 0) { w += sx; dx -= sx; sx = 0; }
+    if (sy < 0) { h += sy; dy -= sy; sy = 0; }
+    if (dx < 0) { w += dx; sx -= dx; dx = 0; }
+    if (dy < 0) { h += dy; sy -= dy; dy = 0; }
+    if (sx + w > src_cols) { w = src_cols - sx; }
+    if (sy + h > src_rows) { h = src_rows - sy; }
+    if (dx + w > dest_cols) { w = dest_cols - dx; }
+    if (dy + h > dest_rows) { h = dest_rows - dy; }
+    if (w <= 0 || h <= 0) { return; }
+
+    // Copy rows bottom-up when moving down within the same buffer
+    bool same = (dest == src);
+    int32_t j = 0, j_step = 1;
+    if (same && dy > sy) { j = h - 1; j_step = -1; }
+    for (int32_t n = 0; n < h; n++, j += j_step) {
+      uint32_t * d = dest + (dy + j) * dest_cols + dx;
+      const uint32_t * s = src + (sy + j) * src_cols + sx;
+      if (blend) {
+        if (same && dx > sx) {
+          for (int32_t i = w - 1; i >= 0; i--) { d[i] = blend_argb(d[i], s[i]); }
+        } else {
+          for (int32_t i = 0; i < w; i++) { d[i] = blend_argb(d[i], s[i]); }
+        }
+      } else {
+        memmove(d, s, w * 4);
+      }
+    }
+  }
+
+  // Reverse pixels in place, used to rotate rows
+  static void reverse_argb(uint32_t * pixels, int32_t n) {
+    for (int32_t i = 0, j = n - 1; i < j; i++, j--) {
+      uint32_t c = pixels[i];
+      pixels[i] = pixels[j];
+      pixels[j] = c;
+    }
+  }
+
+  // frame_buffer_ntv.fill_rect_pixels(pixels:bytes(), cols:int, x:int, y:int, w:int, h:int, color:int) -> nil
+  // Fill a rectangle of a 2D buffer stored row by row, clipped to the buffer
+  int32_t be_animation_ntv_fill_rect_pixels(bvm *vm);
+  int32_t be_animation_ntv_fill_rect_pixels(bvm *vm) {
+    size_t pixels_len = 0;
+    uint32_t * pixels = (uint32_t*) be_tobytes(vm, 1, &pixels_len);
+    if (pixels == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() argument");
+    }
+    int32_t cols = be_toint(vm, 2);
+    if (cols > 0) {
+      fill_rect_argb(pixels, cols, pixels_len / 4 / cols, be_toint(vm, 3), be_toint(vm, 4), be_toint(vm, 5), be_toint(vm, 6), be_toint(vm, 7));
+    }
+    be_return_nil(vm);
+  }
+
+  // frame_buffer_ntv.draw_line_pixels(pixels:bytes(), cols:int, x0:int, y0:int, x1:int, y1:int, color:int) -> nil
+  // Draw a line in a 2D buffer stored row by row using Bresenham's algorithm,
+  // pixels outside the buffer are skipped
+  int32_t be_animation_ntv_draw_line_pixels(bvm *vm);
+  int32_t be_animation_ntv_draw_line_pixels(bvm *vm) {
+    size_t pixels_len = 0;
+    uint32_t * pixels = (uint32_t*) be_tobytes(vm, 1, &pixels_len);
+    if (pixels == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() argument");
+    }
+    int32_t cols = be_toint(vm, 2);
+    int32_t x0 = be_toint(vm, 3);
+    int32_t y0 = be_toint(vm, 4);
+    int32_t x1 = be_toint(vm, 5);
+    int32_t y1 = be_toint(vm, 6);
+    uint32_t color = be_toint(vm, 7);
+    if (cols <= 0) { be_return_nil(vm); }
+    int32_t rows = pixels_len / 4 / cols;
+    // Nothing to draw if both ends are beyond the same edge
+    if ((x0 < 0 && x1 < 0) || (y0 < 0 && y1 < 0) || (x0 >= cols && x1 >= cols) || (y0 >= rows && y1 >= rows)) {
+      be_return_nil(vm);
+    }
+    int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t sy = (y0 < y1) ? 1 : -1;
+    int32_t dx = (x1 - x0) * sx;
+    int32_t dy = (y0 - y1) * sy;
+    int32_t err = dx + dy;
+    while (true) {
+      if (x0 >= 0 && x0 < cols && y0 >= 0 && y0 < rows) {
+        pixels[y0 * cols + x0] = color;
+      }
+      if (x0 == x1 && y0 == y1) { break; }
+      int32_t e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+    be_return_nil(vm);
+  }
+
+  // frame_buffer_ntv.blit_pixels(dest:bytes(), dest_cols:int, src:bytes(), src_cols:int, dx:int, dy:int
+  //                              [, sx:int, sy:int, w:int, h:int, blend:bool]) -> nil
+  // Copy a rectangle from a 2D buffer to another, clipped to both buffers
+  // src can be the same as dest, overlapping areas are handled
+  int32_t be_animation_ntv_blit_pixels(bvm *vm);
+  int32_t be_animation_ntv_blit_pixels(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    size_t dest_len = 0, src_len = 0;
+    uint32_t * dest = (uint32_t*) be_tobytes(vm, 1, &dest_len);
+    const uint32_t * src = (const uint32_t*) be_tobytes(vm, 3, &src_len);
+    if (dest == NULL || src == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    int32_t dest_cols = be_toint(vm, 2);
+    int32_t src_cols = be_toint(vm, 4);
+    if (dest_cols <= 0 || src_cols <= 0) { be_return_nil(vm); }
+    int32_t src_rows = src_len / 4 / src_cols;
+    int32_t sx = (top >= 7 && be_isint(vm, 7)) ? be_toint(vm, 7) : 0;
+    int32_t sy = (top >= 8 && be_isint(vm, 8)) ? be_toint(vm, 8) : 0;
+    int32_t w = (top >= 9 && be_isint(vm, 9)) ? be_toint(vm, 9) : src_cols;
+    int32_t h = (top >= 10 && be_isint(vm, 10)) ? be_toint(vm, 10) : src_rows;
+    bool blend = (top >= 11) && be_tobool(vm, 11);
+    blit_argb(dest, dest_cols, dest_len / 4 / dest_cols, src, src_cols, src_rows,
+              be_toint(vm, 5), be_toint(vm, 6), sx, sy, w, h, blend);
+    be_return_nil(vm);
+  }
+
+  // frame_buffer_ntv.scroll_pixels(pixels:bytes(), cols:int, dx:int, dy:int [, fill:int]) -> nil
+  // Scroll the content of a 2D buffer stored row by row, positive dx moves right and
+  // positive dy moves down; uncovered pixels are set to fill, or if fill is nil the
+  // content wraps around
+  int32_t be_animation_ntv_scroll_pixels(bvm *vm);
+  int32_t be_animation_ntv_scroll_pixels(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    size_t pixels_len = 0;
+    uint32_t * pixels = (uint32_t*) be_tobytes(vm, 1, &pixels_len);
+    if (pixels == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() argument");
+    }
+    int32_t cols = be_toint(vm, 2);
+    int32_t dx = be_toint(vm, 3);
+    int32_t dy = be_toint(vm, 4);
+    if (cols <= 0) { be_return_nil(vm); }
+    int32_t rows = pixels_len / 4 / cols;
+    if (rows <= 0) { be_return_nil(vm); }
+
+    if (top >= 5 && be_isint(vm, 5)) {
+      if (dx == 0 && dy == 0) { be_return_nil(vm); }
+      uint32_t fill = be_toint(vm, 5);
+      blit_argb(pixels, cols, rows, pixels, cols, rows, dx, dy, 0, 0, cols, rows, false);
+      // Fill the uncovered bands
+      if (dy > 0) {
+        fill_rect_argb(pixels, cols, rows, 0, 0, cols, dy, fill);
+      } else if (dy < 0) {
+        fill_rect_argb(pixels, cols, rows, 0, rows + dy, cols, -dy, fill);
+      }
+      if (dx > 0) {
+        fill_rect_argb(pixels, cols, rows, 0, 0, dx, rows, fill);
+      } else if (dx < 0) {
+        fill_rect_argb(pixels, cols, rows, cols + dx, 0, -dx, rows, fill);
+      }
+    } else {
+      // Rotate in place by three reversals, without allocating:
+      // all rows as a single block for dy, then each row for dx
+      dx %= cols;
+      if (dx < 0) { dx += cols; }
+      dy %= rows;
+      if (dy < 0) { dy += rows; }
+      if (dy > 0) {
+        int32_t n = rows * cols;
+        int32_t k = dy * cols;
+        reverse_argb(pixels, n);
+        reverse_argb(pixels, k);
+        reverse_argb(pixels + k, n - k);
+      }
+      if (dx > 0) {
+        for (int32_t y = 0; y < rows; y++) {
+          uint32_t * row = pixels + y * cols;
+          reverse_argb(row, cols);
+          reverse_argb(row, dx);
+          reverse_argb(row + dx, cols - dx);
+        }
+      }
+    }
+    be_return_nil(vm);
+  }
+
+  // frame_buffer_ntv.matrix_remap(cols:int, rows:int [, layout:int]) -> bytes()
+  // Build the remap table of a matrix panel, from logical to physical pixel index,
+  // as 16 bits little-endian indices; layout flags:
+  //   1: serpentine, 2: wired by columns, 4: mirrored horizontally, 8: mirrored vertically
+  int32_t be_animation_ntv_matrix_remap(bvm *vm);
+  int32_t be_animation_ntv_matrix_remap(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    int32_t cols = be_toint(vm, 1);
+    int32_t rows = be_toint(vm, 2);
+    int32_t layout = (top >= 3 && be_isint(vm, 3)) ? be_toint(vm, 3) : 0;
+    if (cols < 0) { cols = 0; }
+    if (rows < 0) { rows = 0; }
+    uint8_t * table = (uint8_t*) be_pushbytes(vm, NULL, cols * rows * 2);
+    for (int32_t y = 0; y < rows; y++) {
+      int32_t py = (layout & 8) ? rows - 1 - y : y;
+      for (int32_t x = 0; x < cols; x++) {
+        int32_t px = (layout & 4) ? cols - 1 - x : x;
+        int32_t line = py, pos = px, line_len = cols;
+        if (layout & 2) { line = px; pos = py; line_len = rows; }
+        if ((layout & 1) && (line & 1)) { pos = line_len - 1 - pos; }
+        uint32_t idx = line * line_len + pos;
+        uint8_t * entry = table + (y * cols + x) * 2;
+        entry[0] = idx & 0xFF;
+        entry[1] = (idx >> 8) & 0xFF;
+      }
+    }
+    be_return(vm);
+  }
+
+  // frame_buffer_ntv.remap_pixels(dest:bytes(), src:bytes(), table:bytes()) -> nil
+  // Copy each pixel of src to dest at the 16 bits index from table, see matrix_remap()
+  // Indices outside of dest are skipped, src must not be the same as dest
+  int32_t be_animation_ntv_remap_pixels(bvm *vm);
+  int32_t be_animation_ntv_remap_pixels(bvm *vm) {
+    size_t dest_len = 0, src_len = 0, table_len = 0;
+    uint32_t * dest = (uint32_t*) be_tobytes(vm, 1, &dest_len);
+    const uint32_t * src = (const uint32_t*) be_tobytes(vm, 2, &src_len);
+    const uint8_t * table = (const uint8_t*) be_tobytes(vm, 3, &table_len);
+    if (dest == NULL || src == NULL || table == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    size_t dest_width = dest_len / 4;
+    size_t n = src_len / 4;
+    if (n > table_len / 2) { n = table_len / 2; }
+    for (size_t i = 0; i < n; i++) {
+      size_t d = table[i * 2] | (table[i * 2 + 1] << 8);
+      if (d < dest_width) { dest[d] = src[i]; }
+    }
+    be_return_nil(vm);
+  }
+
+  // High precision buffers store 16 bits per channel, 8 bytes per pixel, as
+  // four 16 bits little-endian values in the same order as ARGB bytes in
+  // memory: blue, green, red, alpha. 8 bits values v are stored as v * 257.
+
+  // frame_buffer_ntv.blend_pixels16(dest16:bytes(), src:bytes() [, opacity:int]) -> nil
+  // Blend an ARGB buffer into a high precision buffer using per-pixel alpha
+  // opacity (0..511, default 255) is applied to the source alpha at 16 bits
+  int32_t be_animation_ntv_blend_pixels16(bvm *vm);
+  int32_t be_animation_ntv_blend_pixels16(bvm *vm) {
+    int32_t top = be_top(vm);
+    size_t dest_len = 0, src_len = 0;
+    uint16_t * dest = (uint16_t*) be_tobytes(vm, 1, &dest_len);
+    const uint32_t * src = (const uint32_t*) be_tobytes(vm, 2, &src_len);
+    if (dest == NULL || src == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    int32_t opacity = 255;
+    if (top >= 3 && be_isint(vm, 3)) {
+      opacity = be_toint(vm, 3);
+      if (opacity < 0) { opacity = 0; }
+      if (opacity > 511) { opacity = 511; }
+    }
+    size_t n = src_len / 4;
+    if (n > dest_len / 8) { n = dest_len / 8; }
+    for (size_t i = 0; i < n; i++) {
+      uint32_t color = src[i];
+      // alpha scaled to 0..4096, same rounding as the Berry implementation
+      int32_t a = (((color >> 24) & 0xFF) * opacity * 4096 + 32512) / 65025;
+      if (a <= 0) { continue; }
+      uint16_t * d = dest + i * 4;
+      int32_t b = (color & 0xFF) * 257;
+      int32_t g = ((color >> 8) & 0xFF) * 257;
+      int32_t r = ((color >> 16) & 0xFF) * 257;
+      if (a >= 4096) {
+        d[0] = b;
+        d[1] = g;
+        d[2] = r;
+        d[3] = 0xFFFF;
+      } else {
+        d[0] = d[0] + (b - (int32_t)d[0]) * a / 4096;
+        d[1] = d[1] + (g - (int32_t)d[1]) * a / 4096;
+        d[2] = d[2] + (r - (int32_t)d[2]) * a / 4096;
+        d[3] = d[3] + (0xFFFF - (int32_t)d[3]) * a / 4096;
+      }
+    }
+    be_return_nil(vm);
+  }
+
+  // Gamma curve at 16 bits, same breakpoints as the 10 bits LED gamma table
+  static const uint16_t gamma16_table[] = {
+    0, 0,  64, 64,  256, 64,  13389, 833,  19987, 2627,  29276, 6791,
+    40103, 16720,  48815, 28828,  57335, 45036,  65535, 65535
+  };
+
+  static uint32_t gamma16(uint32_t v) {
+    const uint16_t * t = gamma16_table;
+    size_t i = 2;
+    while (v > t[i]) { i += 2; }
+    uint32_t from = t[i - 2];
+    if (v <= from) { return t[i - 1]; }
+    return t[i - 1] + (v - from) * (t[i + 1] - t[i - 1]) / (t[i] - from);
+  }
+
+  // 4x4 ordered dithering thresholds, in 1/16 of an 8 bits step
+  static const uint8_t bayer16[16] = { 0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5 };
+
+  // frame_buffer_ntv.dither_pixels(dest:bytes(), src16:bytes() [, bri:int, gamma:bool, phase:int]) -> nil
+  // Convert a high precision buffer to opaque ARGB with brightness (0..510, default 255),
+  // gamma (default false) and ordered dithering applied at 16 bits
+  // phase is incremented at each frame so that every pixel cycles through all thresholds
+  int32_t be_animation_ntv_dither_pixels(bvm *vm);
+  int32_t be_animation_ntv_dither_pixels(bvm *vm) {
+    int32_t top = be_top(vm);
+    size_t dest_len = 0, src_len = 0;
+    uint32_t * dest = (uint32_t*) be_tobytes(vm, 1, &dest_len);
+    const uint16_t * src = (const uint16_t*) be_tobytes(vm, 2, &src_len);
+    if (dest == NULL || src == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    uint32_t bri = 255;
+    if (top >= 3 && be_isint(vm, 3)) {
+      int32_t b = be_toint(vm, 3);
+      bri = (b < 0) ? 0 : ((b > 510) ? 510 : b);
+    }
+    bool gamma = (top >= 4) ? be_tobool(vm, 4) : false;
+    uint32_t phase = (top >= 5 && be_isint(vm, 5)) ? be_toint(vm, 5) : 0;
+    size_t n = src_len / 8;
+    if (n > dest_len / 4) { n = dest_len / 4; }
+    for (size_t i = 0; i < n; i++) {
+      uint32_t thr = bayer16[(i + phase) & 0x0F] * 16 + 8;
+      uint32_t color = 0xFF000000;
+      for (uint32_t c = 0; c < 3; c++) {
+        uint32_t v = src[i * 4 + c];
+        if (bri != 255) {
+          v = v * bri / 255;
+          if (v > 0xFFFF) { v = 0xFFFF; }
+        }
+        if (gamma) { v = gamma16(v); }
+        color |= ((((v * 255 + 255) >> 8) + thr) >> 8) << (c * 8);
+      }
+      dest[i] = color;
+    }
+    be_return_nil(vm);
+  }
+
+  // frame_buffer_ntv.palette_lut(lut:bytes(), palette:bytes(), lut_factor:int [, curve:bytes()]) -> nil
+  // Build a color lookup table of (256 >> lut_factor) + 1 ARGB colors from a palette,
+  // entry i holds the color for value i << lut_factor and the last entry the color for 255
+  // palette entries are 4 bytes (position, red, green, blue), positions are values
+  // in 0..255 or tick counts when the first position is non zero
+  // curve is an optional 256 bytes easing curve applied between two entries, nil for linear
+  int32_t be_animation_ntv_palette_lut(bvm *vm);
+  int32_t be_animation_ntv_palette_lut(bvm *vm) {
+    int32_t top = be_top(vm);
+    size_t lut_len = 0, palette_len = 0, curve_len = 0;
+    uint32_t * lut = (uint32_t*) be_tobytes(vm, 1, &lut_len);
+    const uint8_t * palette = (const uint8_t*) be_tobytes(vm, 2, &palette_len);
+    if (lut == NULL || palette == NULL) {
+      be_raise(vm, "argument_error", "needs bytes() arguments");
+    }
+    int32_t lut_factor = be_toint(vm, 3);
+    if (lut_factor < 0 || lut_factor > 7) {
+      be_raise(vm, "argument_error", "lut_factor must be 0..7");
+    }
+    const uint8_t * curve = NULL;
+    if (top >= 4 && be_isbytes(vm, 4)) {
+      curve = (const uint8_t*) be_tobytes(vm, 4, &curve_len);
+      if (curve_len < 256) {
+        be_raise(vm, "argument_error", "curve needs 256 bytes");
+      }
+    }
+    size_t n = (256 >> lut_factor) + 1;
+    if (n > lut_len / 4) { n = lut_len / 4; }
+    size_t slots = palette_len / 4;
+    if (slots < 2) {
+      uint32_t color = 0xFFFFFFFF;
+      if (slots > 0) {
+        color = 0xFF000000 | (palette[1] << 16) | (palette[2] << 8) | palette[3];
+      }
+      for (size_t i = 0; i < n; i++) { lut[i] = color; }
+      be_return_nil(vm);
+    }
+
+    if (slots > 256) {
+      be_raise(vm, "argument_error", "palette has more than 256 entries");
+    }
+    // positions of entries in 0..255
+    uint8_t pos[256];
+    if (palette[0] != 0) {
+      uint32_t total_ticks = 0;
+      for (size_t i = 0; i < slots - 1; i++) { total_ticks += palette[i * 4]; }
+      uint32_t cur_ticks = 0;
+      for (size_t i = 0; i < slots; i++) {
+        pos[i] = changeUIntScale(cur_ticks, 0, total_ticks, 0, 255);
+        cur_ticks += palette[i * 4];
+      }
+    } else {
+      for (size_t i = 0; i < slots; i++) { pos[i] = palette[i * 4]; }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      uint32_t value = i << lut_factor;
+      if (value > 255) { value = 255; }
+      size_t idx = slots - 2;
+      while (idx > 0 && value < pos[idx]) { idx--; }
+      uint32_t t0 = pos[idx];
+      uint32_t t1 = pos[idx + 1];
+      const uint8_t * e0 = palette + idx * 4;
+      const uint8_t * e1 = e0 + 4;
+      uint32_t color = 0xFF000000;
+      for (uint32_t c = 1; c < 4; c++) {
+        uint32_t v;
+        if (curve != NULL) {
+          v = changeUIntScale(curve[changeUIntScale(value, t0, t1, 0, 255)], 0, 255, e0[c], e1[c]);
+        } else {
+          v = changeUIntScale(value, t0, t1, e0[c], e1[c]);
+        }
+        color |= v << ((3 - c) * 8);
+      }
+      lut[i] = color;
+    }
+    be_return_nil(vm);
+  }
+
+  // Same as `tasmota.scale_uint()` in Berry, on 32 bits ints
+  static int32_t osc_scale_uint(int32_t num, int32_t from_min, int32_t from_max, int32_t to_min, int32_t to_max) {
+    if (from_min >= from_max) { return (to_min > to_max) ? to_max : to_min; }
+    num = (num > from_max) ? from_max : ((num < from_min) ? from_min : num);
+    if (to_min > to_max) {
+      int32_t tmp = to_min;
+      num = (from_max - num) + from_min;
+      to_min = to_max;
+      to_max = tmp;
+    }
+    if (num == from_min) { return to_min; }
+    if (num == from_max) { return to_max; }
+    int32_t result;
+    if ((num - from_min) < 0x8000) {
+      if (to_max - to_min > from_max - from_min) {
+        int32_t numerator = (num - from_min) * (to_max - to_min) * 2;
+        result = ((numerator / (from_max - from_min)) + 1) / 2 + to_min;
+      } else {
+        int32_t numerator = ((num - from_min) * 2 + 1) * (to_max - to_min + 1);
+        result = numerator / ((from_max - from_min + 1) * 2) + to_min;
+      }
+    } else {
+      int32_t numerator = (num - from_min) * (to_max - to_min + 1);
+      result = numerator / (from_max - from_min) + to_min;
+    }
+    return (result > to_max) ? to_max : ((result < to_min) ? to_min : result);
+  }
+
+  // Same as `tasmota.scale_int()` in Berry
+  static int32_t osc_scale_int(int32_t num, int32_t from_min, int32_t from_max, int32_t to_min, int32_t to_max) {
+    if (from_min >= from_max) { return (to_min > to_max) ? to_max : to_min; }
+    int32_t from_offset = (from_min < 0) ? -from_min : 0;
+    int32_t to_offset = (to_min < 0) ? -to_min : 0;
+    if (to_max < -to_offset) { to_offset = -to_max; }
+    return osc_scale_uint(num + from_offset, from_min + from_offset, from_max + from_offset,
+                          to_min + to_offset, to_max + to_offset) - to_offset;
+  }
+
+  // Same as `tasmota.sine_int()` in Berry, 32768 is a full period and the result is -4096..4096
+  static int32_t osc_sine_int(int32_t i) {
+    float x = (float)i / 16384.0f;
+    x = x * 3.14159265358979f;
+    return (int32_t)(sinf(x) * 4096.0f);
+  }
+
+  // Easing curves indexed by the position in the period (0..255), precomputed
+  // from the Berry implementation in `FrameBufferNtv._ease()`
+  static const uint8_t osc_ease_in[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8,
+    9, 9, 9, 10, 10, 11, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15,
+    16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 22, 22, 23, 23, 24,
+    25, 25, 26, 27, 27, 28, 29, 29, 30, 31, 31, 32, 33, 34, 34, 35,
+    36, 37, 37, 38, 39, 40, 40, 41, 42, 43, 44, 45, 45, 46, 47, 48,
+    49, 50, 51, 52, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 80,
+    81, 82, 83, 85, 86, 87, 88, 89, 90, 92, 93, 94, 95, 97, 98, 99,
+    100, 102, 103, 104, 105, 107, 108, 109, 111, 112, 113, 115, 116, 117, 119, 120,
+    121, 123, 124, 126, 127, 128, 130, 131, 133, 134, 136, 137, 139, 140, 142, 143,
+    145, 146, 148, 149, 151, 152, 154, 155, 157, 159, 160, 162, 163, 165, 167, 168,
+    170, 171, 173, 175, 176, 178, 180, 181, 183, 185, 187, 188, 190, 192, 194, 195,
+    197, 199, 201, 202, 204, 206, 208, 210, 211, 213, 215, 217, 219, 221, 223, 224,
+    226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 253, 255
+  };
+  static const uint8_t osc_ease_out[256] = {
+    0, 2, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29,
+    31, 32, 34, 36, 38, 40, 42, 44, 45, 47, 49, 51, 53, 54, 56, 58,
+    60, 61, 63, 65, 67, 68, 70, 72, 74, 75, 77, 79, 80, 82, 84, 85,
+    87, 88, 90, 92, 93, 95, 96, 98, 100, 101, 103, 104, 106, 107, 109, 110,
+    112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127, 128, 129, 131, 132, 134,
+    135, 136, 138, 139, 140, 142, 143, 144, 146, 147, 148, 150, 151, 152, 153, 155,
+    156, 157, 158, 160, 161, 162, 163, 165, 166, 167, 168, 169, 170, 172, 173, 174,
+    175, 176, 177, 178, 179, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 203, 204, 205, 206,
+    207, 208, 209, 210, 210, 211, 212, 213, 214, 215, 215, 216, 217, 218, 218, 219,
+    220, 221, 221, 222, 223, 224, 224, 225, 226, 226, 227, 228, 228, 229, 230, 230,
+    231, 232, 232, 233, 233, 234, 235, 235, 236, 236, 237, 237, 238, 238, 239, 239,
+    240, 240, 241, 241, 242, 242, 243, 243, 244, 244, 244, 245, 245, 246, 246, 246,
+    247, 247, 248, 248, 248, 249, 249, 249, 250, 250, 250, 250, 251, 251, 251, 251,
+    252, 252, 252, 252, 253, 253, 253, 253, 253, 254, 254, 254, 254, 254, 254, 254,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+  };
+  static const uint8_t osc_bounce[256] = {
+    0, 3, 7, 11, 15, 19, 23, 27, 31, 34, 38, 42, 45, 49, 53, 56,
+    60, 63, 67, 70, 74, 77, 80, 84, 87, 90, 93, 96, 100, 103, 106, 109,
+    112, 115, 118, 121, 124, 127, 129, 132, 135, 138, 140, 143, 146, 148, 151, 153,
+    156, 158, 161, 163, 166, 168, 170, 173, 175, 177, 179, 182, 184, 186, 188, 190,
+    193, 195, 197, 199, 201, 203, 204, 206, 208, 210, 211, 213, 215, 216, 218, 219,
+    221, 222, 224, 225, 226, 228, 229, 230, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 246, 247, 248, 249, 249, 250, 250, 251, 251,
+    252, 252, 253, 253, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+    0, 3, 7, 11, 15, 19, 22, 26, 30, 34, 37, 41, 44, 48, 51, 54,
+    57, 60, 63, 66, 68, 71, 74, 76, 79, 81, 84, 86, 88, 91, 93, 95,
+    98, 100, 102, 103, 105, 107, 108, 110, 111, 113, 114, 116, 117, 118, 119, 120,
+    121, 122, 123, 124, 125, 125, 126, 126, 127, 127, 128, 128, 128, 128, 128, 128,
+    191, 192, 194, 196, 198, 200, 202, 204, 206, 208, 209, 211, 213, 215, 216, 218,
+    219, 221, 222, 224, 225, 227, 228, 229, 230, 232, 233, 234, 235, 237, 238, 239,
+    240, 241, 242, 243, 244, 244, 245, 246, 247, 248, 248, 249, 250, 250, 251, 251,
+    252, 252, 253, 253, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255
+  };
+  // Spring oscillation of ELASTIC, from `FrameBufferNtv._elastic_offset()`
+  static const int16_t osc_elastic_offset[256] = {
+    0, 5, 10, 15, 20, 24, 29, 33, 36, 39, 41, 42, 41, 40, 39, 36,
+    32, 28, 22, 16, 9, 2, -6, -13, -21, -28, -36, -42, -47, -52, -56, -59,
+    -60, -60, -59, -56, -52, -47, -40, -33, -24, -15, -5, 5, 15, 26, 36, 45,
+    54, 62, 68, 73, 76, 78, 78, 77, 74, 69, 62, 54, 44, 34, 22, 10,
+    -3, -16, -29, -42, -54, -65, -74, -83, -89, -94, -97, -98, -95, -92, -86, -78,
+    -69, -58, -45, -31, -16, 0, 16, 32, 47, 61, 75, 87, 96, 105, 111, 115,
+    116, 115, 111, 105, 95, 84, 71, 56, 40, 23, 5, -14, -32, -50, -68, -83,
+    -98, -110, -120, -128, -132, -134, -133, -130, -123, -113, -101, -87, -69, -51, -31, -11,
+    11, 32, 53, 73, 91, 108, 122, 135, 144, 150, 153, 153, 148, 141, 131, 118,
+    102, 84, 63, 41, 18, -6, -30, -54, -76, -98, -117, -134, -148, -159, -167, -171,
+    -172, -168, -161, -151, -136, -119, -99, -77, -52, -27, 0, 27, 53, 79, 103, 125,
+    144, 161, 174, 184, 189, 190, 187, 181, 170, 155, 137, 115, 91, 64, 36, 7,
+    -22, -51, -80, -107, -131, -154, -173, -188, -199, -207, -209, -207, -200, -189, -174, -155,
+    -132, -107, -78, -48, -16, 16, 48, 80, 109, 137, 162, 184, 201, 214, 223, 227,
+    226, 221, 210, 194, 174, 150, 123, 93, 60, 26, -9, -44, -78, -111, -141, -169,
+    -193, -214, -229, -240, -245, -245, -240, -230, -215, -194, -169, -141, -108, -74, -38, 0
+  };
+
+  static int32_t oscillator_value(int32_t form, int32_t duration, int32_t phase, int32_t duty_cycle,
+                                  int32_t min_value, int32_t max_value, int32_t past) {
+    if (duration <= 0) { return min_value; }
+    if (past < 0) { past = 0; }
+    if (past >= duration) { past = past % duration; }
+    if (phase > 0) {
+      past += osc_scale_uint(phase, 0, 255, 0, duration);
+      if (past >= duration) { past -= duration; }
+    }
+    switch (form) {
+      case 1:   // SAWTOOTH
+        return osc_scale_int(past, 0, duration - 1, min_value, max_value);
+      case 2: { // TRIANGLE
+        int32_t mid = osc_scale_uint(duty_cycle, 0, 255, 0, duration);
+        if (past < mid) {
+          return osc_scale_int(past, 0, mid - 1, min_value, max_value);
+        }
+        return osc_scale_int(past, mid, duration - 1, max_value, min_value);
+      }
+      case 3:   // SQUARE
+        return (past < osc_scale_uint(duty_cycle, 0, 255, 0, duration)) ? min_value : max_value;
+      case 4:   // COSINE
+      case 5: { // SINE
+        int32_t angle = osc_scale_uint(past, 0, duration - 1, 0, 32767);
+        if (form == 4) { angle -= 8192; }     // dephase from cosine to sine
+        return osc_scale_int(osc_sine_int(angle), -4096, 4096, min_value, max_value);
+      }
+      case 6:   // EASE_IN
+      case 7:   // EASE_OUT
+      case 9: { // BOUNCE
+        int32_t t = osc_scale_uint(past, 0, duration - 1, 0, 255);
+        const uint8_t * curve = (form == 6) ? osc_ease_in : ((form == 7) ? osc_ease_out : osc_bounce);
+        return osc_scale_int(curve[t], 0, 255, min_value, max_value);
+      }
+      case 8: { // ELASTIC
+        int32_t t = osc_scale_uint(past, 0, duration - 1, 0, 255);
+        if (t == 0) { return min_value; }
+        if (t == 255) { return max_value; }
+        int32_t value_range = max_value - min_value;
+        int32_t value = min_value + osc_scale_int(t, 0, 255, 0, value_range) + osc_elastic_offset[t];
+        // clamp overshoots
+        int32_t max_overshoot = osc_scale_int(value_range, 0, 4, 0, 1);
+        if (value > max_value + max_overshoot) { value = max_value + max_overshoot; }
+        if (value < min_value - max_overshoot) { value = min_value - max_overshoot; }
+        return value;
+      }
+    }
+    return min_value;
+  }
+
+  // frame_buffer_ntv.oscillator_value(form:int, duration:int, phase:int, duty_cycle:int, min_value:int, max_value:int, past:int) -> int
+  // Value of an oscillator waveform (animation.SAWTOOTH..animation.BOUNCE) at 'past' ms since its start
+  int32_t be_animation_ntv_oscillator_value(bvm *vm);
+  int32_t be_animation_ntv_oscillator_value(bvm *vm) {
+    if (be_top(vm) < 7) {
+      be_raise(vm, "argument_error", "needs 7 int arguments");
+    }
+    be_pushint(vm, oscillator_value(be_toint(vm, 1), be_toint(vm, 2), be_toint(vm, 3), be_toint(vm, 4),
+                                    be_toint(vm, 5), be_toint(vm, 6), be_toint(vm, 7)));
+    be_return(vm);
+  }
+
+  // frame_buffer_ntv.oscillator_fill(dest:bytes(), form:int, duration:int, phase:int, duty_cycle:int, min_value:int, max_value:int, past:int [, shift:int]) -> nil
+  // Evaluate one sample per byte of 'dest', clamped to 0..255, sample i being 'i * shift' ms
+  // after 'past' wrapped in the period
+  int32_t be_animation_ntv_oscillator_fill(bvm *vm);
+  int32_t be_animation_ntv_oscillator_fill(bvm *vm) {
+    int32_t top = be_top(vm);
+    size_t dest_len = 0;
+    uint8_t * dest = (uint8_t*) be_tobytes(vm, 1, &dest_len);
+    if (dest == NULL || top < 8) {
+      be_raise(vm, "argument_error", "needs bytes() and 7 int arguments");
+    }
+    int32_t form = be_toint(vm, 2);
+    int32_t duration = be_toint(vm, 3);
+    int32_t phase = be_toint(vm, 4);
+    int32_t duty_cycle = be_toint(vm, 5);
+    int32_t min_value = be_toint(vm, 6);
+    int32_t max_value = be_toint(vm, 7);
+    int32_t past = be_toint(vm, 8);
+    int32_t shift = (top >= 9 && be_isint(vm, 9)) ? be_toint(vm, 9) : 0;
+    for (size_t i = 0; i < dest_len; i++) {
+      int32_t t = past + (int32_t)i * shift;
+      if (duration > 0) {
+        t = t % duration;
+        if (t < 0) { t += duration; }
+      }
+      int32_t v = oscillator_value(form, duration, phase, duty_cycle, min_value, max_value, t);
+      dest[i] = (v < 0) ? 0 : ((v > 255) ? 255 : v);
+    }
+    be_return_nil(vm);
+  }
+
   // // Leds_frame.paste_pixels(neopixel:bytes(), led_buffer:bytes(), bri:int 0..100, gamma:bool)
   // //
   // // Copy from ARGB buffer to RGB